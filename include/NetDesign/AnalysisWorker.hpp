@@ -0,0 +1,136 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_ANALYSIS_WORKER_HPP
+#define NET_DESIGN_ANALYSIS_WORKER_HPP
+
+#include <NetDesign/NetworkAnalysis.hpp>
+#include <QtCore/QObject>
+#include <condition_variable>
+#include <stop_token>
+#include <functional>
+#include <optional>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <mutex>
+
+
+namespace netd {
+
+struct AnalysisResult {
+    Route              m_route;
+    std::vector<Route> m_alternatives;
+    LinkUsage          m_linkUsage;
+    std::uint64_t      m_edgeVersion {0}; // version of analyzed edge table
+    std::uint32_t      m_src {0};
+    std::uint32_t      m_dest {0};
+    std::uint32_t      m_totalDelay {0}; // ms
+};
+
+using AnalysisProgress = std::function<void(std::int32_t percent)>;
+using AnalysisCallback = std::function<void(const AnalysisResult& result)>;
+
+/**
+ * @brief Runner of network analysis on worker thread.
+ *
+ * Analysis reads project snapshot, so project can be edited meanwhile.
+ * Progress & result are queued to receiver thread, results of canceled
+ * or restarted analysis are dropped there.
+ *
+ * Each worker owns one thread, started analysis & route search share it,
+ * so the next one of either cancels the previous one. Restart doesn't wait
+ * for canceled analysis, it is stopped between its stages & picked next
+ * job is the last started one. Graph is kept until edges or channels change.
+ */
+class AnalysisWorker {
+    using Task = std::function<void(const ProjectContext& context, NetworkAnalysis& analysis,
+                                    std::stop_token stopToken)>;
+
+    struct Job {
+        std::shared_ptr<const ProjectContext> m_snapshot;
+        Task                                  m_task;
+    };
+
+    QObject                     *m_receiver;
+    std::uint64_t               m_run {0}; // changed on receiver thread only
+    bool                        m_isRunning {false};
+    std::mutex                  m_mutex;
+    std::condition_variable_any m_condition;
+    std::optional<Job>          m_job;     // the next job, replaced by restart
+    std::stop_source            m_stop;    // of the running job
+    std::jthread                m_thread;  // the last member, it is joined first
+
+    private:
+        void post(std::uint64_t run, std::function<void(void)> function) noexcept;
+        void schedule(std::shared_ptr<const ProjectContext> snapshot, Task task) noexcept;
+        void loop(std::stop_token stopToken) noexcept;
+
+    public:
+        /**
+         * @brief Construct analysis worker.
+         *
+         * @param [in] receiver - given object, progress & result are delivered in its thread.
+         */
+        explicit AnalysisWorker(QObject *receiver) noexcept;
+        ~AnalysisWorker(void) noexcept;
+        AnalysisWorker(const AnalysisWorker&) = delete;
+        AnalysisWorker& operator=(const AnalysisWorker&) = delete;
+
+        /**
+         * @brief Start route, alternatives, link usage & total delay analysis, previous analysis is canceled.
+         *
+         * @param [in] snapshot - given project snapshot.
+         * @param [in] src - given source node position.
+         * @param [in] dest - given destination node position.
+         * @param [in] weight - given channel field used as edge weight.
+         * @param [in] progress - given progress callback.
+         * @param [in] callback - given result callback.
+         */
+        void start(std::shared_ptr<const ProjectContext> snapshot, std::uint32_t src, std::uint32_t dest,
+                   ChannelMemberPtr weight, AnalysisProgress progress, AnalysisCallback callback) noexcept;
+
+        /**
+         * @brief Start route & alternatives search only, previous analysis is canceled.
+         *
+         * Result has no link usage & total delay.
+         *
+         * @param [in] snapshot - given project snapshot.
+         * @param [in] src - given source node position.
+         * @param [in] dest - given destination node position.
+         * @param [in] weight - given channel field used as edge weight.
+         * @param [in] callback - given result callback.
+         */
+        void findRoutes(std::shared_ptr<const ProjectContext> snapshot, std::uint32_t src, std::uint32_t dest,
+                        ChannelMemberPtr weight, AnalysisCallback callback) noexcept;
+
+        /** @brief Cancel analysis, its progress & result are not delivered.*/
+        void cancel(void) noexcept;
+
+        /**
+         * @brief Check whether analysis result is awaited.
+         *
+         * @return true if analysis is running, false otherwise.
+         */
+        bool isRunning(void) const noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_ANALYSIS_WORKER_HPP
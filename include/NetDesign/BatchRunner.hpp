@@ -0,0 +1,114 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_BATCH_RUNNER_HPP
+#define NET_DESIGN_BATCH_RUNNER_HPP
+
+#include <NetDesign/NetworkAnalysis.hpp>
+#include <NetDesign/ProjectContext.hpp>
+#include <string_view>
+#include <functional>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace netd {
+
+/** @brief Overrides applied to project before analysis.*/
+struct Scenario {
+    std::vector<Channel> m_channels;        // channel catalog, project channels are kept if empty
+    std::uint32_t        m_packetSize {0};  // packet size, project one is kept if zero
+    double               m_loadScale {1.0}; // node loads multiplier
+};
+
+struct BatchResult {
+    std::string   m_filename;
+    std::size_t   m_nodeCount {0};
+    std::size_t   m_edgeCount {0};
+    std::uint64_t m_totalPrice {0};
+    std::uint32_t m_totalDelay {0};
+    double        m_elapsed {0.0};          // seconds
+    bool          m_isOk {false};
+};
+
+using BatchCallback = std::function<void(const BatchResult&)>;
+
+/**
+ * @brief Apply scenario overrides to project.
+ *
+ * @param [out] context - given project context.
+ * @param [in] scenario - given scenario.
+ */
+void applyScenario(ProjectContext& context, const Scenario& scenario) noexcept;
+
+/**
+ * @brief Evaluates many project files concurrently.
+ *
+ * Each project is loaded into its own context on one of bounded number
+ * of worker threads, so only projects being evaluated are kept in memory.
+ */
+class BatchRunner {
+    public:
+        /**
+         * @brief Get project files to evaluate.
+         *
+         * @param [in] path - given directory of projects or manifest file
+         * with one project file name per line.
+         * @return project file names.
+         */
+        static std::vector<std::string> getProjects(const std::string_view& path) noexcept;
+
+        /**
+         * @brief Load channel catalog.
+         *
+         * @param [in] filename - given catalog file name ("id,capacity,price" lines).
+         * @param [out] channels - given loaded channels.
+         * @return true if catalog was loaded successfully, false otherwise.
+         */
+        static bool loadChannels(const std::string_view& filename, std::vector<Channel>& channels) noexcept;
+
+        /**
+         * @brief Evaluate single project.
+         *
+         * @param [in] filename - given project file name.
+         * @param [in] scenario - given scenario.
+         * @param [in] weight - given channel field used as edge weight.
+         * @return evaluation result.
+         */
+        static BatchResult evaluate(const std::string& filename, const Scenario& scenario, ChannelMemberPtr weight) noexcept;
+
+        /**
+         * @brief Evaluate projects on thread pool.
+         *
+         * Callback is called for each result as soon as it is ready,
+         * calls are serialized, but results come in completion order.
+         *
+         * @param [in] projects - given project file names.
+         * @param [in] scenario - given scenario.
+         * @param [in] weight - given channel field used as edge weight.
+         * @param [in] threadCount - given maximum number of worker threads.
+         * @param [in] callback - given result callback.
+         */
+        static void run(const std::vector<std::string>& projects, const Scenario& scenario, ChannelMemberPtr weight,
+                        std::size_t threadCount, const BatchCallback& callback) noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_BATCH_RUNNER_HPP
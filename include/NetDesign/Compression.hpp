@@ -0,0 +1,95 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_COMPRESSION_HPP
+#define NET_DESIGN_COMPRESSION_HPP
+
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <condition_variable>
+#include <string_view>
+#include <streambuf>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+
+namespace netd {
+
+enum class Compression {
+    None,
+    Gzip,
+    Zstd,
+};
+
+/**
+ * @brief Get compression of project file by its extension.
+ *
+ * @param [in] filename - given project file name.
+ * @return compression type (.gz - gzip, .zst - zstd, otherwise none).
+ */
+Compression getCompression(const std::string_view& filename) noexcept;
+
+/**
+ * @brief Push compressing filter into output stream.
+ *
+ * @param [out] stream - given filtering output stream.
+ * @param [in] compression - given compression type.
+ */
+void pushCompressor(boost::iostreams::filtering_ostream& stream, Compression compression) noexcept;
+
+/**
+ * @brief Stream buffer reading decompressed project file.
+ *
+ * Decompression runs on separate thread which fills bounded queue
+ * of chunks, so parsing overlaps with decompression and the whole
+ * file is never held in memory.
+ */
+class DecompressBuffer : public std::streambuf {
+    using Chunk = std::vector<char>;
+
+    std::condition_variable m_condition;
+    std::deque<Chunk>       m_ready;
+    std::vector<Chunk>      m_free;
+    std::mutex              m_mutex;
+    std::thread             m_thread;
+    Chunk                   m_current;
+    bool                    m_isStopped {false};
+    bool                    m_isFailed {false};
+    bool                    m_isDone {false};
+
+    private:
+        void decompress(boost::iostreams::file_source source, Compression compression) noexcept;
+        bool push(Chunk& chunk) noexcept;
+
+    protected:
+        int_type underflow(void) override;
+
+    public:
+        DecompressBuffer(void) noexcept = default;
+        ~DecompressBuffer(void) noexcept override;
+
+        bool open(const std::string_view& filename, Compression compression) noexcept;
+        void close(void) noexcept;
+        bool isFailed(void) noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_COMPRESSION_HPP
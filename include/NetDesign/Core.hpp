@@ -0,0 +1,42 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @brief Public API of netdesign-core library.
+ *
+ * Core library contains project model, project file I/O & network
+ * analysis, it depends on Boost & Qt Core only, so it can be embedded
+ * into services without GUI.
+ */
+
+#ifndef NET_DESIGN_CORE_HPP
+#define NET_DESIGN_CORE_HPP
+
+#include <NetDesign/NetworkAnalysis.hpp>
+#include <NetDesign/BatchRunner.hpp>
+#include <NetDesign/SpatialIndex.hpp>
+#include <NetDesign/GraphLayout.hpp>
+#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/ProjectJournal.hpp>
+#include <NetDesign/Project.hpp>
+#include <NetDesign/TopologyParser.hpp>
+#include <NetDesign/TopologyWriter.hpp>
+#include <NetDesign/ProjectParser.hpp>
+#include <NetDesign/ProjectWriter.hpp>
+
+#endif // NET_DESIGN_CORE_HPP
@@ -0,0 +1,106 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_EDGE_TABLE_HPP
+#define NET_DESIGN_EDGE_TABLE_HPP
+
+#include <cstdint>
+#include <vector>
+
+
+namespace netd {
+
+struct Edge {
+    std::uint32_t m_source;
+    std::uint32_t m_target;
+    std::uint32_t m_channel;
+};
+
+/**
+ * @brief Edges stored as columns of source, target & channel positions.
+ */
+class EdgeTable {
+    std::vector<std::uint32_t> m_sources;
+    std::vector<std::uint32_t> m_targets;
+    std::vector<std::uint32_t> m_channels;
+
+    public:
+        std::size_t size(void) const noexcept {
+            return m_sources.size();
+        }
+
+        bool empty(void) const noexcept {
+            return m_sources.empty();
+        }
+
+        void reserve(std::size_t size) noexcept {
+            m_sources.reserve(size);
+            m_targets.reserve(size);
+            m_channels.reserve(size);
+        }
+
+        void resize(std::size_t size) noexcept {
+            m_sources.resize(size, 0);
+            m_targets.resize(size, 0);
+            m_channels.resize(size, 0);
+        }
+
+        void push_back(const Edge& edge) noexcept {
+            m_sources.push_back(edge.m_source);
+            m_targets.push_back(edge.m_target);
+            m_channels.push_back(edge.m_channel);
+        }
+
+        std::uint32_t source(std::size_t edge) const noexcept {
+            return m_sources[edge];
+        }
+
+        std::uint32_t target(std::size_t edge) const noexcept {
+            return m_targets[edge];
+        }
+
+        std::uint32_t channel(std::size_t edge) const noexcept {
+            return m_channels[edge];
+        }
+
+        const std::vector<std::uint32_t>& sources(void) const noexcept {
+            return m_sources;
+        }
+
+        const std::vector<std::uint32_t>& targets(void) const noexcept {
+            return m_targets;
+        }
+
+        const std::vector<std::uint32_t>& channels(void) const noexcept {
+            return m_channels;
+        }
+
+        Edge edge(std::size_t edge) const noexcept {
+            return {m_sources[edge], m_targets[edge], m_channels[edge]};
+        }
+
+        void set(std::size_t edge, const Edge& value) noexcept {
+            m_sources[edge]  = value.m_source;
+            m_targets[edge]  = value.m_target;
+            m_channels[edge] = value.m_channel;
+        }
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_EDGE_TABLE_HPP
@@ -0,0 +1,57 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_EDGE_TABLE_DELEGATE_HPP
+#define NET_DESIGN_EDGE_TABLE_DELEGATE_HPP
+
+#include <QtWidgets/QStyledItemDelegate>
+#include <QtCore/QAbstractItemModel>
+#include <NetDesign/ProjectContext.hpp>
+
+
+namespace netd {
+
+/**
+ * @brief Editor delegate of edge table.
+ *
+ * Combo box editor is created only for the cell being edited. Node
+ * columns share one node name model & can be searched by typing,
+ * channel column lists channel capacities.
+ */
+class EdgeTableDelegate : public QStyledItemDelegate {
+    QAbstractItemModel   *m_nodeNames;
+    const ProjectContext *m_context;
+
+    public:
+        /**
+         * @brief Construct edge table delegate.
+         *
+         * @param [in] nodeNames - given node name model, it must outlive delegate.
+         * @param [in] context - given project context, it must outlive delegate.
+         * @param [in] parent - given parent object.
+         */
+        EdgeTableDelegate(QAbstractItemModel *nodeNames, const ProjectContext& context, QObject *parent = nullptr) noexcept;
+
+        QWidget *createEditor(QWidget *parent, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+        void setEditorData(QWidget *editor, const QModelIndex& index) const override;
+        void setModelData(QWidget *editor, QAbstractItemModel *model, const QModelIndex& index) const override;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_EDGE_TABLE_DELEGATE_HPP
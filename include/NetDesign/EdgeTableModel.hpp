@@ -0,0 +1,87 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_EDGE_TABLE_MODEL_HPP
+#define NET_DESIGN_EDGE_TABLE_MODEL_HPP
+
+#include <QtCore/QAbstractTableModel>
+#include <NetDesign/Project.hpp>
+
+
+namespace netd {
+
+enum EdgeColumn : std::int32_t {
+    EDGE_SOURCE_COLUMN,
+    EDGE_TARGET_COLUMN,
+    EDGE_CHANNEL_COLUMN,
+    EDGE_COLUMN_COUNT,
+};
+
+/**
+ * @brief Table model of edges being edited.
+ *
+ * Model edits its own copy of project edge table, which shares data with
+ * project until the first edit, so rows are applied to project at once
+ * on submit. Cells are shown as node names & channel capacities, their
+ * edit role is node or channel position.
+ */
+class EdgeTableModel : public QAbstractTableModel {
+    const Project     *m_project;
+    Shared<EdgeTable> m_edges;
+
+    public:
+        /**
+         * @brief Construct edge table model.
+         *
+         * @param [in] project - given project, it must outlive model.
+         * @param [in] parent - given parent object.
+         */
+        explicit EdgeTableModel(const Project& project, QObject *parent = nullptr) noexcept;
+
+        /** @brief Drop edits & reload edge table of project.*/
+        void reset(void) noexcept;
+
+        /** @brief Append edge between first nodes over first channel.*/
+        void insertEdge(void) noexcept;
+
+        /**
+         * @brief Remove edge.
+         *
+         * @param [in] row - given edge position.
+         * @return true if edge was removed, false otherwise.
+         */
+        bool removeEdge(std::int32_t row) noexcept;
+
+        /**
+         * @brief Get edited edge table.
+         *
+         * @return edge table.
+         */
+        const Shared<EdgeTable>& edges(void) const noexcept;
+
+        std::int32_t rowCount(const QModelIndex& parent = QModelIndex()) const override;
+        std::int32_t columnCount(const QModelIndex& parent = QModelIndex()) const override;
+        QVariant data(const QModelIndex& index, std::int32_t role = Qt::DisplayRole) const override;
+        QVariant headerData(std::int32_t section, Qt::Orientation orientation, std::int32_t role = Qt::DisplayRole) const override;
+        bool setData(const QModelIndex& index, const QVariant& value, std::int32_t role = Qt::EditRole) override;
+        Qt::ItemFlags flags(const QModelIndex& index) const override;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_EDGE_TABLE_MODEL_HPP
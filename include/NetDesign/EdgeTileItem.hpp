@@ -0,0 +1,106 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_EDGE_TILE_ITEM_HPP
+#define NET_DESIGN_EDGE_TILE_ITEM_HPP
+
+#include <QtWidgets/QGraphicsItem>
+#include <QtGui/QColor>
+#include <cstdint>
+#include <vector>
+#include <array>
+#include <span>
+
+
+namespace netd {
+
+// upper utilization bounds of heat classes, heat 0 is edge without heat
+constexpr std::array<float, 4> HEAT_BOUNDS {0.25f, 0.5f, 0.75f, 1.0f};
+constexpr std::size_t HEAT_CLASS_COUNT {HEAT_BOUNDS.size() + 2};
+
+/**
+ * @brief Scene item drawing all edges of one tile.
+ *
+ * Edges are assigned to tiles of scene grid by their midpoints & kept in
+ * contiguous line array grouped by heat class & sorted by length, so each
+ * class of tile is drawn by a single call. Edges shorter than a few pixels
+ * at current zoom are not drawn, instead tile cell is shaded by their count.
+ * Tile isn't hit tested, edges under cursor are found by graph view index.
+ */
+class EdgeTileItem : public QGraphicsItem {
+    struct EdgeLine {
+        std::uint32_t m_edge; // position of edge in tile
+        std::uint8_t  m_heat {0};
+    };
+
+    using HeatCounts = std::array<std::size_t, HEAT_CLASS_COUNT>;
+
+    std::vector<QLineF>   m_lines;
+    std::vector<EdgeLine> m_edgeLines;
+    HeatCounts            m_heatOffsets {};
+    QRectF                m_cell;
+    QRectF                m_bounds;
+
+    private:
+        void sortLines(void) noexcept;
+        void visibleCounts(double lod, HeatCounts& counts) const noexcept;
+
+    public:
+        /**
+         * @brief Construct edge tile item.
+         *
+         * @param [in] cell - given tile cell of scene grid.
+         */
+        explicit EdgeTileItem(const QRectF& cell) noexcept;
+
+        /**
+         * @brief Add edge to tile.
+         *
+         * @param [in] line - given edge line.
+         */
+        void addEdge(const QLineF& line) noexcept;
+
+        /** @brief Sort edges by length after all of them were added.*/
+        void finish(void) noexcept;
+
+        /**
+         * @brief Recolor edges by their utilization.
+         *
+         * @param [in] utilizations - given utilizations in order edges were added, empty to remove heat.
+         * @param [in] threshold - given utilization, edges below it get no heat.
+         */
+        void setHeat(std::span<const float> utilizations, float threshold) noexcept;
+
+        /**
+         * @brief Get heat class of edge.
+         *
+         * @param [in] utilization - given edge utilization.
+         * @param [in] threshold - given utilization, edges below it get no heat.
+         * @return heat class, 0 if edge has no heat.
+         */
+        static std::size_t getHeat(float utilization, float threshold) noexcept;
+        static QColor getHeatColor(std::size_t heat) noexcept;
+        static double getHeatWidth(std::size_t heat) noexcept;
+
+        QRectF boundingRect(void) const override;
+        void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) override;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_EDGE_TILE_ITEM_HPP
@@ -19,7 +19,12 @@
 #ifndef NET_DESIGN_GRAPH_CONTROLLER_HPP
 #define NET_DESIGN_GRAPH_CONTROLLER_HPP
 
-#include <NetDesign/NetworkGraph.hpp>
+#include <NetDesign/EdgeTableDelegate.hpp>
+#include <NetDesign/AnalysisWorker.hpp>
+#include <NetDesign/LayoutWorker.hpp>
+#include <NetDesign/EdgeTableModel.hpp>
+#include <NetDesign/NodeNameModel.hpp>
+#include <NetDesign/Project.hpp>
 #include <NetDesign/GraphView.hpp>
 
 
@@ -28,20 +33,29 @@ namespace netd {
 class GraphController : public QObject
 {
     private:
-        GraphView        *m_graphView;
-        ChannelMemberPtr m_weight;
-        NetworkGraph     m_graph;
+        Project           *m_project;
+        GraphView         *m_graphView;
+        NodeNameModel     *m_nodeNames;
+        EdgeTableModel    *m_edgeModel;
+        EdgeTableDelegate *m_edgeDelegate;
+        ChannelMemberPtr  m_weight;
+        AnalysisWorker    m_worker {this};
+        AnalysisWorker    m_routeWorker {this}; // own thread, route search doesn't cancel analysis
+        LayoutWorker      m_layoutWorker {this};
 
         void updateEdgeTable(void) noexcept;
-        void insertEdgeTableRow(bool flag) noexcept;
         void calculateDelays(void) noexcept;
-        std::tuple<std::uint32_t, std::uint32_t> calculateRouteDelay(void) noexcept;
-        std::uint32_t calculateDelay(double capacity, double load) noexcept;
-        std::uint32_t calculateTotalDelay(void) noexcept;
+        void showDelays(const AnalysisResult& result) noexcept;
+        std::tuple<std::uint32_t, std::uint32_t> showRoute(const AnalysisResult& result) noexcept;
+        void updateRoutes(void) noexcept;
+        void showRoutes(const AnalysisResult& result) noexcept;
+        void startLayout(void) noexcept;
+        void stopLayout(void) noexcept;
+        void finishLayout(const LayoutResult& result) noexcept;
 
 
     public:
-        GraphController(GraphView *graphView) noexcept;
+        GraphController(Project& project, GraphView *graphView) noexcept;
         void updateContent(void) noexcept;
 };
 
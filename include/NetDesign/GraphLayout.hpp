@@ -0,0 +1,129 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_GRAPH_LAYOUT_HPP
+#define NET_DESIGN_GRAPH_LAYOUT_HPP
+
+#include <NetDesign/EdgeTable.hpp>
+#include <NetDesign/NodeTable.hpp>
+#include <stop_token>
+#include <functional>
+#include <cstdint>
+#include <vector>
+
+
+namespace netd {
+
+class GraphLayout;
+
+// called after each iteration with number of done iterations
+using LayoutIteration = std::function<void(const GraphLayout& layout, std::size_t iteration)>;
+
+/**
+ * @brief Force-directed layout of network nodes.
+ *
+ * Fruchterman-Reingold layout, where repulsion of all node pairs is
+ * approximated by Barnes-Hut quadtree, so iteration costs O(n log n) and
+ * repulsion is split between threads by node ranges. When only some nodes
+ * have coordinates, they are pinned & the rest are laid out around them,
+ * otherwise all nodes are laid out from scratch. Node at origin has no coordinates.
+ */
+class GraphLayout {
+    // cell of quadtree, leaf holds one node or nodes at the same point
+    struct Cell {
+        float         m_x {0.0f};    // center of mass
+        float         m_y {0.0f};
+        float         m_mass {0.0f};
+        float         m_minX {0.0f};
+        float         m_minY {0.0f};
+        float         m_size {0.0f};
+        std::uint32_t m_child {0};   // the first of 4 children, 0 for leaf
+    };
+
+    std::vector<Cell>          m_cells;
+    std::vector<float>         m_xs;
+    std::vector<float>         m_ys;
+    std::vector<float>         m_dxs;        // displacement of iteration
+    std::vector<float>         m_dys;
+    std::vector<std::uint32_t> m_sources;
+    std::vector<std::uint32_t> m_targets;
+    std::vector<std::uint8_t>  m_isPinned;
+    std::size_t                m_threadCount {1};
+    float                      m_temperature {0.0f};
+    float                      m_gravity {0.0f};
+    float                      m_centerX {0.0f};
+    float                      m_centerY {0.0f};
+    bool                       m_hasPinned {false};
+
+    private:
+        void buildTree(void) noexcept;
+        void insert(std::uint32_t node) noexcept;
+        void split(std::uint32_t cell) noexcept;
+        std::uint32_t quadrant(std::uint32_t cell, float x, float y) const noexcept;
+        void repulse(std::size_t first, std::size_t last) noexcept;
+        void attract(void) noexcept;
+        void move(void) noexcept;
+
+    public:
+        /**
+         * @brief Prepare layout of nodes.
+         *
+         * @param [in] nodes - given node table.
+         * @param [in] edgeTable - given edge table.
+         * @param [in] threadCount - given maximum number of threads.
+         */
+        void set(const NodeTable& nodes, const EdgeTable& edgeTable, std::size_t threadCount = 1) noexcept;
+
+        /**
+         * @brief Move nodes by one iteration.
+         *
+         * @return true if nodes still move, false if layout converged.
+         */
+        bool step(void) noexcept;
+
+        /**
+         * @brief Run layout until it converges.
+         *
+         * @param [in] maxIterations - given maximum number of iterations.
+         * @param [in] stopToken - given token, layout is stopped when stop is requested.
+         * @param [in] callback - given callback, called after each iteration.
+         */
+        void run(std::size_t maxIterations, std::stop_token stopToken = {}, const LayoutIteration& callback = {}) noexcept;
+
+        /**
+         * @brief Get node coordinates of current layout.
+         *
+         * Free nodes are shifted to positive coordinates, unless there are
+         * pinned ones, which keep their coordinates.
+         *
+         * @param [out] xs - given node x coordinates.
+         * @param [out] ys - given node y coordinates.
+         */
+        void getPositions(std::vector<std::uint32_t>& xs, std::vector<std::uint32_t>& ys) const noexcept;
+
+        /**
+         * @brief Write node coordinates of current layout.
+         *
+         * @param [out] nodes - given node table, it must have the same size as laid out one.
+         */
+        void apply(NodeTable& nodes) const noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_GRAPH_LAYOUT_HPP
@@ -20,19 +20,60 @@
 #define NET_DESIGN_GRAPH_VIEW_HPP
 
 #include <QtWidgets/QGraphicsScene>
+#include <QtWidgets/QGraphicsView>
 #include <QtWidgets/QTableWidget>
+#include <QtWidgets/QTableView>
 #include <QtWidgets/QRadioButton>
+#include <QtWidgets/QProgressBar>
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QPushButton>
-#include <NetDesign/Channel.hpp>
+#include <NetDesign/NetworkAnalysis.hpp>
+#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/SpatialIndex.hpp>
 #include <QtWidgets/QTabWidget>
+#include <QtWidgets/QCheckBox>
+#include <QtWidgets/QSpinBox>
 #include <QtWidgets/QComboBox>
-#include <NetDesign/Node.hpp>
 #include <QtWidgets/QLabel>
+#include <QtGui/QWheelEvent>
+#include <QtGui/QMouseEvent>
+#include <QtGui/QHelpEvent>
+#include <QtGui/QPixmap>
+#include <unordered_map>
+#include <compare>
+#include <tuple>
+#include <span>
+#include <vector>
 
 
 namespace netd {
 
+class EdgeTileItem;
+class RouteItem;
+class NodeItem;
+
+// drawn edge, edges of tile are compared to find tiles to redraw
+struct EdgeRecord {
+    std::uint64_t m_tile;
+    std::uint32_t m_srcX;
+    std::uint32_t m_srcY;
+    std::uint32_t m_destX;
+    std::uint32_t m_destY;
+    std::uint32_t m_edge; // edge table row, not compared as rows shift on removal
+
+    auto key(void) const noexcept {
+        return std::tie(m_tile, m_srcX, m_srcY, m_destX, m_destY);
+    }
+
+    bool operator==(const EdgeRecord& other) const noexcept {
+        return key() == other.key();
+    }
+
+    auto operator<=>(const EdgeRecord& other) const noexcept {
+        return key() <=> other.key();
+    }
+};
+
 class GraphView : public QObject
 {
     private:
@@ -40,9 +81,52 @@ class GraphView : public QObject
         QVBoxLayout    *m_buttonLayout;
         QVBoxLayout    *m_graphLayout;
         QGraphicsScene *m_scene;
+        QGraphicsView  *m_view;
+        QPixmap        m_nodeIcon;
+        RouteItem      *m_routeItem;
+
+        // sections drawn on scene, items refer to this snapshot
+        Shared<NodeTable>            m_nodes;
+        Shared<EdgeTable>            m_edges;
+        Shared<std::vector<Channel>> m_channels;
+
+        std::vector<NodeItem*>                           m_nodeItems; // by node position
+        std::unordered_map<std::uint64_t, EdgeTileItem*> m_tileItems; // by tile
+        std::vector<EdgeRecord>                          m_edgeRecords;
+
+        // utilization of edge table rows of given version
+        LinkUsage     m_linkUsage;
+        std::uint64_t m_usageVersion {0};
+        bool          m_isHeatShown {false};
+
+        // highlighted routes refer to edge table rows of given version
+        std::vector<Route> m_routes;
+        std::uint64_t      m_routeVersion {0};
 
+        // drawn nodes & edges for hit tests, selection & scene bounds
+        SpatialIndex               m_index;
+        std::vector<std::uint32_t> m_selectedNodes;
+        QRectF                     m_rubberBand;
+        QPointF                    m_pressPosition;
+        bool                       m_isFitted {false};
+
+        void loadNodeIcon(void) noexcept;
+        void updateNodes(const NodeTable& oldNodes) noexcept;
+        void updateEdges(void) noexcept;
+        void updateTile(std::uint64_t tile, std::span<const EdgeRecord> records) noexcept;
+        std::vector<EdgeRecord> getEdgeRecords(void) const noexcept;
+        void updateSceneRect(void) noexcept;
+        void updateRoutes(void) noexcept;
+        void zoom(const QWheelEvent *event) noexcept;
+        void showToolTip(const QHelpEvent *event) noexcept;
+        void finishSelection(const QMouseEvent *event) noexcept;
+        void selectNodes(std::span<const std::uint32_t> nodes, bool isAdded) noexcept;
+        QString getNodeToolTip(std::uint32_t node) const noexcept;
+        QString getEdgeToolTip(std::uint32_t edge) const noexcept;
+        double getScale(void) const noexcept;
         void setGraphLayout(void) noexcept;
         void setButtonLayout(void) noexcept;
+        void setHeatmapLayout(void) noexcept;
         void setEdgeTable(void) noexcept;
 
     public:
@@ -55,18 +139,91 @@ class GraphView : public QObject
         QComboBox    *m_srcNodeComboBox;
         QComboBox    *m_destNodeComboBox;
         QPushButton  *m_findRouteButton;
+        QPushButton  *m_cancelButton;
+        QProgressBar *m_progressBar;
         QPushButton  *m_updateButton;
+        QPushButton  *m_fitButton;
+        QPushButton  *m_layoutButton;
+        QCheckBox    *m_heatmapCheckBox;
+        QSpinBox     *m_thresholdSpinBox;
+        QLabel       *m_legendLabel;
 
-        QTableWidget *m_edgeTable;
+        QTableView   *m_edgeTable;
         QTableWidget *m_loadTable;
         QPushButton  *m_addButton;
         QPushButton  *m_removeButton;
         QPushButton  *m_submitButton;
 
         GraphView(QWidget *parent = nullptr) noexcept;
-        void drawNode(const Node& node) noexcept;
-        void drawEdge(const Node& src, const Node& dest, const Channel& channel) noexcept;
-        void clearGraph(void) noexcept;
+
+        /**
+         * @brief Handle zoom, tooltips & selection of graph viewport.
+         *
+         * Wheel zooms under cursor, drag pans view, shift drag selects
+         * nodes & click selects the nearest node, ctrl adds to selection.
+         * The first two selected nodes are set as route source & destination.
+         */
+        bool eventFilter(QObject *object, QEvent *event) override;
+
+        /**
+         * @brief Update scene to project sections.
+         *
+         * Only items of changed nodes & tiles of changed edges are
+         * updated, sections shared with drawn snapshot are skipped.
+         *
+         * @param [in] context - given project context.
+         */
+        void updateGraph(const ProjectContext& context) noexcept;
+
+        /** @brief Zoom view to fit all nodes.*/
+        void fitView(void) noexcept;
+
+        /**
+         * @brief Switch route buttons while analysis runs in background.
+         *
+         * @param [in] isRunning - given flag whether analysis is running.
+         */
+        void setAnalysisRunning(bool isRunning) noexcept;
+
+        /**
+         * @brief Switch layout button while auto-layout runs in background.
+         *
+         * @param [in] isRunning - given flag whether layout is running.
+         */
+        void setLayoutRunning(bool isRunning) noexcept;
+
+        /**
+         * @brief Move drawn nodes to intermediate layout coordinates.
+         *
+         * Only drawn snapshot is changed, project is updated by final layout.
+         *
+         * @param [in] xs - given node x coordinates.
+         * @param [in] ys - given node y coordinates.
+         */
+        void showLayout(std::span<const std::uint32_t> xs, std::span<const std::uint32_t> ys) noexcept;
+
+        /**
+         * @brief Set utilization of edges shown by heatmap.
+         *
+         * Usage of other edge table version than the drawn one is not shown.
+         *
+         * @param [in] usage - given utilization & delay of edges.
+         * @param [in] edgeVersion - given version of edge table usage was calculated for.
+         */
+        void setLinkUsage(LinkUsage usage, std::uint64_t edgeVersion) noexcept;
+
+        /**
+         * @brief Highlight route & its alternatives.
+         *
+         * Routes of other edge table version than the drawn one are not shown.
+         *
+         * @param [in] routes - given routes, the chosen one first, empty to remove highlight.
+         * @param [in] edgeVersion - given version of edge table routes were found in.
+         */
+        void setRoutes(std::vector<Route> routes, std::uint64_t edgeVersion) noexcept;
+
+        /** @brief Recolor edge tiles by heatmap settings, items are kept.*/
+        void updateHeatmap(void) noexcept;
 };
 
 } // namespace netd
@@ -0,0 +1,96 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_LAYOUT_WORKER_HPP
+#define NET_DESIGN_LAYOUT_WORKER_HPP
+
+#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/GraphLayout.hpp>
+#include <QtCore/QObject>
+#include <functional>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+namespace netd {
+
+// intermediate node coordinates
+struct LayoutFrame {
+    std::vector<std::uint32_t> m_xs;
+    std::vector<std::uint32_t> m_ys;
+};
+
+struct LayoutResult {
+    NodeTable     m_nodes;
+    std::uint64_t m_nodeVersion {0}; // version of laid out node table
+};
+
+using LayoutProgress = std::function<void(const LayoutFrame& frame)>;
+using LayoutCallback = std::function<void(const LayoutResult& result)>;
+
+/**
+ * @brief Runner of graph auto-layout on worker thread.
+ *
+ * Layout reads project snapshot, intermediate coordinates are queued to
+ * receiver thread at most at frame rate & only after previous frame was
+ * shown, so slow scene update doesn't pile up frames.
+ */
+class LayoutWorker {
+    std::jthread  m_thread;
+    QObject       *m_receiver;
+    std::uint64_t m_run {0}; // changed on receiver thread only
+    bool          m_isRunning {false};
+
+    private:
+        void post(std::uint64_t run, std::function<void(void)> function) noexcept;
+
+    public:
+        /**
+         * @brief Construct layout worker.
+         *
+         * @param [in] receiver - given object, frames & result are delivered in its thread.
+         */
+        explicit LayoutWorker(QObject *receiver) noexcept : m_receiver(receiver) {}
+        LayoutWorker(const LayoutWorker&) = delete;
+        LayoutWorker& operator=(const LayoutWorker&) = delete;
+
+        /**
+         * @brief Start layout of nodes, previous layout is canceled.
+         *
+         * @param [in] snapshot - given project snapshot.
+         * @param [in] progress - given intermediate frame callback.
+         * @param [in] callback - given result callback.
+         */
+        void start(std::shared_ptr<const ProjectContext> snapshot, LayoutProgress progress, LayoutCallback callback) noexcept;
+
+        /** @brief Cancel layout, its frames & result are not delivered.*/
+        void cancel(void) noexcept;
+
+        /**
+         * @brief Check whether layout result is awaited.
+         *
+         * @return true if layout is running, false otherwise.
+         */
+        bool isRunning(void) const noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_LAYOUT_WORKER_HPP
@@ -0,0 +1,112 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_LOAD_MATRIX_HPP
+#define NET_DESIGN_LOAD_MATRIX_HPP
+
+#include <NetDesign/Shared.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+
+namespace netd {
+
+/**
+ * @brief Square load matrix stored as copy-on-write blocks of rows.
+ *
+ * Project versions share blocks, so editing a cell copies only
+ * its block instead of the whole matrix.
+ */
+class LoadMatrix {
+    using Block = std::vector<std::uint32_t>;
+
+    std::vector<Shared<Block>> m_blocks;
+    std::size_t                m_size {0};
+
+    public:
+        static constexpr std::size_t BLOCK_ROWS {64};
+
+        std::size_t size1(void) const noexcept {
+            return m_size;
+        }
+
+        std::size_t size2(void) const noexcept {
+            return m_size;
+        }
+
+        std::size_t blockCount(void) const noexcept {
+            return m_blocks.size();
+        }
+
+        std::uint32_t operator()(std::size_t row, std::size_t column) const noexcept {
+            return this->row(row)[column];
+        }
+
+        /**
+         * @brief Get matrix row.
+         *
+         * @param [in] row - given row position.
+         * @return pointer to row cells.
+         */
+        const std::uint32_t *row(std::size_t row) const noexcept {
+            return m_blocks[row / BLOCK_ROWS]->data() + (row % BLOCK_ROWS) * m_size;
+        }
+
+        /**
+         * @brief Get matrix row for modification.
+         *
+         * @param [in] row - given row position.
+         * @return pointer to row cells, block of row is no longer shared.
+         */
+        std::uint32_t *editRow(std::size_t row) noexcept {
+            return m_blocks[row / BLOCK_ROWS].edit().data() + (row % BLOCK_ROWS) * m_size;
+        }
+
+        void set(std::size_t row, std::size_t column, std::uint32_t value) noexcept {
+            editRow(row)[column] = value;
+        }
+
+        /**
+         * @brief Resize matrix, all cells are set to zero.
+         *
+         * @param [in] size - given number of rows & columns.
+         */
+        void resize(std::size_t size) noexcept {
+            m_size = size;
+            m_blocks.clear();
+
+            for (std::size_t first = 0; first < size; first += BLOCK_ROWS)
+                m_blocks.push_back(Block(std::min(BLOCK_ROWS, size - first) * size, 0));
+        }
+
+        /**
+         * @brief Check whether block is shared with other matrix.
+         *
+         * @param [in] other - given other matrix of the same size.
+         * @param [in] block - given block position.
+         * @return true if block is shared, false otherwise.
+         */
+        bool isSameBlock(const LoadMatrix& other, std::size_t block) const noexcept {
+            return m_blocks[block].isSame(other.m_blocks[block]);
+        }
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_LOAD_MATRIX_HPP
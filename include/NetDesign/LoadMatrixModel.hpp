@@ -0,0 +1,60 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_LOAD_MATRIX_MODEL_HPP
+#define NET_DESIGN_LOAD_MATRIX_MODEL_HPP
+
+#include <QtCore/QAbstractTableModel>
+#include <NetDesign/Project.hpp>
+
+
+namespace netd {
+
+/**
+ * @brief Table model of project load matrix.
+ *
+ * Cells are read from & written to load matrix directly, so view creates
+ * only cells that are visible. Each edited cell is a separate project
+ * version & journal record, node load is updated by cell difference.
+ */
+class LoadMatrixModel : public QAbstractTableModel {
+    Project *m_project;
+
+    public:
+        /**
+         * @brief Construct load matrix model.
+         *
+         * @param [in] project - given project, it must outlive model.
+         * @param [in] parent - given parent object.
+         */
+        explicit LoadMatrixModel(Project& project, QObject *parent = nullptr) noexcept;
+
+        /** @brief Reload matrix after it was resized or replaced.*/
+        void reset(void) noexcept;
+
+        std::int32_t rowCount(const QModelIndex& parent = QModelIndex()) const override;
+        std::int32_t columnCount(const QModelIndex& parent = QModelIndex()) const override;
+        QVariant data(const QModelIndex& index, std::int32_t role = Qt::DisplayRole) const override;
+        QVariant headerData(std::int32_t section, Qt::Orientation orientation, std::int32_t role = Qt::DisplayRole) const override;
+        bool setData(const QModelIndex& index, const QVariant& value, std::int32_t role = Qt::EditRole) override;
+        Qt::ItemFlags flags(const QModelIndex& index) const override;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_LOAD_MATRIX_MODEL_HPP
@@ -22,19 +22,57 @@
 #include <NetDesign/MenuController.hpp>
 #include <NetDesign/TabController.hpp>
 #include <NetDesign/TabView.hpp>
+#include <NetDesign/Project.hpp>
 #include <QtWidgets/QMainWindow>
+#include <string_view>
+#include <memory>
+#include <vector>
 
 
 namespace netd {
 
+struct ProjectTab {
+    std::unique_ptr<Project> m_project;
+    TabController            *m_tabController;
+    TabView                  *m_tabView;
+};
+
 class MainWindow : public QMainWindow {
-    MenuController *m_menuController;
-    TabController  *m_tabController;
-    MenuView       *m_menuView;
-    TabView        *m_tabView;
+    std::vector<ProjectTab> m_projects;
+    MenuController          *m_menuController;
+    MenuView                *m_menuView;
+    QTabWidget              *m_projectTabs;
+
+    private:
+        void closeProject(std::int32_t index) noexcept;
+        void updateTitle(std::int32_t index) noexcept;
 
     public:
         MainWindow(void) noexcept;
+
+        /**
+         * @brief Open new empty project in its own tab.
+         *
+         * @return added project.
+         */
+        Project& addProject(void) noexcept;
+
+        /**
+         * @brief Get project of current tab.
+         *
+         * @return current project.
+         */
+        Project& currentProject(void) noexcept;
+
+        /**
+         * @brief Switch to tab of already opened project file.
+         *
+         * @param [in] filename - given project file name.
+         * @return true if project is already opened, false otherwise.
+         */
+        bool selectProject(const std::string_view& filename) noexcept;
+
+        /** @brief Update content of current project tab.*/
         void updateContent(void) noexcept;
 };
 
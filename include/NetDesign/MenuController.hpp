@@ -42,8 +42,20 @@ class MenuController : public QObject
         /** @brief "Project" Save action handler.*/
         void onProjectSave(void) noexcept;
 
+        /** @brief "Project" Import Topology action handler.*/
+        void onProjectImport(void) noexcept;
+
+        /** @brief "Project" Export Topology action handler.*/
+        void onProjectExport(void) noexcept;
+
         /** @brief "Project" Exit action handler.*/
         void onProjectExit(void) noexcept;
+
+        /** @brief "Edit" Undo action handler.*/
+        void onEditUndo(void) noexcept;
+
+        /** @brief "Edit" Redo action handler.*/
+        void onEditRedo(void) noexcept;
 };
 
 } // namespace netd
@@ -0,0 +1,171 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_NETWORK_ANALYSIS_HPP
+#define NET_DESIGN_NETWORK_ANALYSIS_HPP
+
+#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/NetworkGraph.hpp>
+#include <stop_token>
+#include <functional>
+#include <cstdint>
+#include <vector>
+#include <span>
+
+
+namespace netd {
+
+enum class RouteStatus {
+    Ok,
+    SamePosition,
+    Unreachable,
+    NoCapacity,
+};
+
+struct Route {
+    std::vector<std::size_t>   m_path;        // node positions from source to destination
+    std::vector<std::uint32_t> m_edges;       // edge table rows of path
+    RouteStatus                m_status {RouteStatus::Ok};
+    std::uint32_t              m_delay {0};   // ms, maximum value if channel is overloaded
+    std::uint32_t              m_price {0};
+};
+
+// utilization & delay of each edge, in order of edge table
+struct LinkUsage {
+    std::vector<float>         m_utilizations; // load / capacity, 0 if channel is invalid or has no capacity
+    std::vector<std::uint32_t> m_delays;       // ms, maximum value if channel is overloaded
+};
+
+// number of evaluated source nodes & total number of them
+using ProgressCallback = std::function<void(std::size_t done, std::size_t total)>;
+
+/**
+ * @brief Delay analysis of project network.
+ *
+ * Delays are estimated with M/D/1 queue of the last channel of a route,
+ * loaded by total load of destination node.
+ */
+class NetworkAnalysis {
+    const ProjectContext       *m_context {nullptr};
+    PathWorkspace              m_workspace;
+    std::vector<std::uint32_t> m_penalties; // by arc, for alternative routes
+    std::size_t                m_threadCount {1};
+    std::uint64_t              m_edgeVersion {0};    // versions graph is built of
+    std::uint64_t              m_channelVersion {0};
+
+    private:
+        bool calculateRouteDelay(std::uint32_t lastArc, std::size_t dest, std::uint32_t& delay) const noexcept;
+        void setRoute(Route& route, std::span<const std::uint32_t> path) const noexcept;
+        void penalize(std::size_t src, std::size_t dest) noexcept;
+
+    public:
+        NetworkGraph m_graph;
+
+        /**
+         * @brief Build network graph of project.
+         *
+         * Nodes, edge table & channels must be loaded, packet size
+         * must be loaded before delays are calculated.
+         *
+         * @param [in] context - given project context.
+         * @param [in] threadCount - given maximum number of threads building & searching the graph.
+         */
+        void set(const ProjectContext& context, std::size_t threadCount = 1) noexcept;
+
+        /**
+         * @brief Build network graph of project, unless it is built of the same nodes, edges & channels.
+         *
+         * Context is replaced either way, so loads & packet size are read
+         * from the given one. Sections are the same as of set.
+         *
+         * @param [in] context - given project context.
+         * @param [in] threadCount - given maximum number of threads building & searching the graph.
+         */
+        void update(const ProjectContext& context, std::size_t threadCount = 1) noexcept;
+
+        /**
+         * @brief Calculate M/D/1 delay of channel.
+         *
+         * @param [in] capacity - given channel capacity (packets/sec).
+         * @param [in] load - given channel load (packets/sec).
+         * @return delay in ms, maximum value if channel is overloaded.
+         */
+        static std::uint32_t calculateDelay(double capacity, double load) noexcept;
+
+        /**
+         * @brief Calculate utilization & M/D/1 delay of all edges.
+         *
+         * Edge is loaded by the larger load of its nodes, as either of them
+         * may be destination served by it. Nodes, edge table, channels &
+         * packet size must be loaded, graph isn't needed.
+         *
+         * @param [in] context - given project context.
+         * @param [out] usage - given link usage, it is resized to edge table.
+         */
+        static void calculateLinkUsage(const ProjectContext& context, LinkUsage& usage) noexcept;
+
+        /**
+         * @brief Find the shortest route between nodes & its delay.
+         *
+         * @param [in] src - given source node position.
+         * @param [in] dest - given destination node position.
+         * @param [in] weight - given channel field used as edge weight.
+         * @return route between nodes.
+         */
+        Route findRoute(std::uint32_t src, std::uint32_t dest, ChannelMemberPtr weight) noexcept;
+
+        /**
+         * @brief Find the shortest route between nodes & its alternatives.
+         *
+         * Penalty method: after route is found, weights of its edges are
+         * multiplied & the next route is searched, so each route costs one
+         * search regardless of its length. Alternatives avoid edges of found
+         * routes where detour is cheap, they aren't the exact k-shortest.
+         *
+         * @param [in] src - given source node position.
+         * @param [in] dest - given destination node position.
+         * @param [in] weight - given channel field used as edge weight.
+         * @param [in] count - given maximum number of routes.
+         * @param [in] stopToken - given token, alternatives aren't searched when stop is requested.
+         * @return distinct routes, the first one is the same as of findRoute.
+         */
+        std::vector<Route> findRoutes(std::uint32_t src, std::uint32_t dest, ChannelMemberPtr weight,
+                                      std::size_t count, std::stop_token stopToken = {}) noexcept;
+
+        /**
+         * @brief Calculate average delay of all reachable routes.
+         *
+         * @param [in] weight - given channel field used as edge weight.
+         * @param [in] stopToken - given token, calculation is stopped when stop is requested.
+         * @param [in] progress - given callback, called after routes of each source node.
+         * @return average delay in ms, average of evaluated routes if calculation was stopped.
+         */
+        std::uint32_t calculateTotalDelay(ChannelMemberPtr weight, std::stop_token stopToken = {},
+                                          const ProgressCallback& progress = {}) noexcept;
+
+        /**
+         * @brief Calculate price of all network channels.
+         *
+         * @return sum of channel prices of all edges.
+         */
+        std::uint64_t calculateTotalPrice(void) const noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_NETWORK_ANALYSIS_HPP
@@ -19,36 +19,128 @@
 #ifndef NET_DESIGN_NETWORK_GRAPH_HPP
 #define NET_DESIGN_NETWORK_GRAPH_HPP
 
-#include <boost/graph/adjacency_list.hpp>
-#include <NetDesign/Channel.hpp>
-#include <NetDesign/Node.hpp>
-#include <tuple>
+#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/PathWorkspace.hpp>
+#include <cstdint>
+#include <vector>
 
 
 namespace netd {
 
-using Graph = boost::adjacency_list<
-    boost::vecS,        // vertex container
-    boost::vecS,        // edge container
-    boost::undirectedS, // directed/undirected
-    Node,               // vertex properties
-    Channel             // edge properties
->;
-
-using VertexDescriptor  = boost::graph_traits<Graph>::vertex_descriptor;
-using Distances         = std::vector<std::int32_t>;
-using VertexDescriptors = std::vector<VertexDescriptor>;
-using ChannelMemberPtr  = std::uint32_t Channel::*;
+using ChannelMemberPtr = std::uint32_t Channel::*;
 
+/**
+ * @brief Undirected network graph in compressed sparse row form.
+ *
+ * Each edge is stored as a pair of arcs, arcs of a node are contiguous
+ * & keep order of edge table. Nodes are referred to by their position
+ * in project, arcs refer to channels by position, so graph holds no
+ * copies of node or channel data.
+ */
 class NetworkGraph {
+    std::vector<std::uint32_t>    m_offsets;    // arcs of node are [m_offsets[node], m_offsets[node + 1])
+    std::vector<std::uint32_t>    m_targets;
+    std::vector<std::uint32_t>    m_arcChannels;
+    std::vector<std::uint32_t>    m_arcEdges;   // edge table row of arc
+    Shared<std::vector<Channel>>  m_channels;
+
+    private:
+        void build(const EdgeTable& edgeTable, std::size_t nodeCount, std::size_t channelCount,
+                   std::size_t threadCount) noexcept;
+        std::size_t relaxArcs(const std::vector<std::uint32_t>& nodes, ChannelMemberPtr weight, Distance delta,
+                              bool isLight, std::size_t threadCount, PathWorkspace& workspace) const noexcept;
+        template<typename WeightOf>
+        void search(std::uint32_t src, const WeightOf& weightOf, PathWorkspace& workspace) const noexcept;
+
     public:
         NetworkGraph(void) noexcept = default;
-        void set(void) noexcept;
-        std::tuple<Distances, VertexDescriptors> dijkstra(std::uint32_t src, ChannelMemberPtr weight) noexcept;
 
-        Graph m_adjList;
+        /**
+         * @brief Build graph of project nodes, edge table & channels.
+         *
+         * Arcs are placed with counting sort by node: degrees are counted,
+         * prefix sums give arc offsets & edges are scattered in a second
+         * pass. Large edge tables are split between threads.
+         *
+         * @param [in] context - given project context.
+         * @param [in] threadCount - given maximum number of threads.
+         */
+        void set(const ProjectContext& context, std::size_t threadCount = 1) noexcept;
+
+        void clear(void) noexcept;
+
+        std::size_t nodeCount(void) const noexcept {
+            return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+        }
+
+        std::size_t edgeCount(void) const noexcept {
+            return m_targets.size() / 2;
+        }
+
+        std::uint32_t arcBegin(std::size_t node) const noexcept {
+            return m_offsets[node];
+        }
+
+        std::uint32_t arcEnd(std::size_t node) const noexcept {
+            return m_offsets[node + 1];
+        }
+
+        std::size_t arcCount(void) const noexcept {
+            return m_targets.size();
+        }
+
+        std::uint32_t target(std::uint32_t arc) const noexcept {
+            return m_targets[arc];
+        }
+
+        std::uint32_t edge(std::uint32_t arc) const noexcept {
+            return m_arcEdges[arc];
+        }
+
+        const Channel& channel(std::uint32_t arc) const noexcept {
+            return (*m_channels)[m_arcChannels[arc]];
+        }
+
+        /**
+         * @brief Find the shortest paths from node to all nodes.
+         *
+         * Integer weights are queued in radix heap.
+         *
+         * @param [in] src - given source node position.
+         * @param [in] weight - given channel field used as edge weight.
+         * @param [out] workspace - given workspace receiving distances & predecessors.
+         */
+        void dijkstra(std::uint32_t src, ChannelMemberPtr weight, PathWorkspace& workspace) const noexcept;
+
+        /**
+         * @brief Find the shortest paths from node with penalized arcs.
+         *
+         * @param [in] src - given source node position.
+         * @param [in] weight - given channel field used as edge weight.
+         * @param [in] penalties - given penalties by arc, arc weight is multiplied by penalty + 1.
+         * @param [out] workspace - given workspace receiving distances & predecessors.
+         */
+        void dijkstra(std::uint32_t src, ChannelMemberPtr weight, const std::vector<std::uint32_t>& penalties,
+                      PathWorkspace& workspace) const noexcept;
+
+        /**
+         * @brief Find the shortest paths from node to all nodes in parallel.
+         *
+         * Delta-stepping: nodes are settled by buckets of distance width,
+         * arcs of bucket are relaxed by all threads at once. Light arcs
+         * (weight <= delta) are relaxed until bucket is stable, then
+         * heavy arcs are relaxed once.
+         *
+         * @param [in] src - given source node position.
+         * @param [in] weight - given channel field used as edge weight.
+         * @param [in] delta - given bucket width, 0 to choose it by average degree.
+         * @param [in] threadCount - given maximum number of threads.
+         * @param [out] workspace - given workspace receiving distances & predecessors.
+         */
+        void deltaStepping(std::uint32_t src, ChannelMemberPtr weight, Distance delta,
+                           std::size_t threadCount, PathWorkspace& workspace) const noexcept;
 };
 
 } // namespace netd
 
-#endif // NET_DESIGN_NETWORK_GRAPH_HPP
\ No newline at end of file
+#endif // NET_DESIGN_NETWORK_GRAPH_HPP
@@ -19,17 +19,21 @@
 #ifndef NET_DESIGN_NODE_CONTROLLER_HPP
 #define NET_DESIGN_NODE_CONTROLLER_HPP
 
+#include <NetDesign/LoadMatrixModel.hpp>
 #include <NetDesign/NodeView.hpp>
+#include <NetDesign/Project.hpp>
 
 
 namespace netd {
 
 class NodeController : public QObject
 {
-    NodeView *m_nodeView;
+    NodeView        *m_nodeView;
+    Project         *m_project;
+    LoadMatrixModel *m_loadModel;
 
     public:
-        NodeController(NodeView *nodeView) noexcept;
+        NodeController(Project& project, NodeView *nodeView) noexcept;
         void updateContent(void) noexcept;
 
     private:
@@ -0,0 +1,70 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_NODE_ITEM_HPP
+#define NET_DESIGN_NODE_ITEM_HPP
+
+#include <QtWidgets/QGraphicsItem>
+#include <NetDesign/NodeTable.hpp>
+#include <NetDesign/Shared.hpp>
+#include <QtGui/QPixmap>
+#include <cstdint>
+
+
+namespace netd {
+
+/**
+ * @brief Scene item of node.
+ *
+ * Item refers to node table snapshot & icon owned by graph view instead
+ * of copying them, so it costs a few pointers per node. Item isn't hit
+ * tested, nodes under cursor are found by graph view index.
+ */
+class NodeItem : public QGraphicsItem {
+    const Shared<NodeTable> *m_nodes;
+    const QPixmap           *m_icon;
+    std::uint32_t           m_position;
+    bool                    m_isHighlighted {false};
+
+    public:
+        /**
+         * @brief Construct node item.
+         *
+         * @param [in] nodes - given node table snapshot, it must outlive item.
+         * @param [in] icon - given node icon, it must outlive item.
+         * @param [in] position - given node position in table.
+         */
+        NodeItem(const Shared<NodeTable>& nodes, const QPixmap& icon, std::uint32_t position) noexcept;
+
+        /** @brief Move item to node position after node was edited.*/
+        void refresh(void) noexcept;
+
+        /**
+         * @brief Mark node as selected.
+         *
+         * @param [in] isHighlighted - given flag whether node is selected.
+         */
+        void setHighlighted(bool isHighlighted) noexcept;
+
+        QRectF boundingRect(void) const override;
+        void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) override;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_NODE_ITEM_HPP
@@ -0,0 +1,55 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_NODE_NAME_MODEL_HPP
+#define NET_DESIGN_NODE_NAME_MODEL_HPP
+
+#include <QtCore/QAbstractListModel>
+#include <NetDesign/Project.hpp>
+
+
+namespace netd {
+
+/**
+ * @brief List model of project node names.
+ *
+ * Model is shared by all node selectors, names are read from node
+ * table when they are shown, so selectors don't copy them.
+ */
+class NodeNameModel : public QAbstractListModel {
+    const Project *m_project;
+
+    public:
+        /**
+         * @brief Construct node name model.
+         *
+         * @param [in] project - given project, it must outlive model.
+         * @param [in] parent - given parent object.
+         */
+        explicit NodeNameModel(const Project& project, QObject *parent = nullptr) noexcept;
+
+        /** @brief Reload names after node table was replaced.*/
+        void reset(void) noexcept;
+
+        std::int32_t rowCount(const QModelIndex& parent = QModelIndex()) const override;
+        QVariant data(const QModelIndex& index, std::int32_t role = Qt::DisplayRole) const override;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_NODE_NAME_MODEL_HPP
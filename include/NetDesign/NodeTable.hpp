@@ -0,0 +1,180 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_NODE_TABLE_HPP
+#define NET_DESIGN_NODE_TABLE_HPP
+
+#include <NetDesign/Node.hpp>
+#include <string_view>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace netd {
+
+/**
+ * @brief Nodes stored as columns.
+ *
+ * Ids & coordinates are kept in separate arrays, names are packed into
+ * a single string arena, so code that needs only positions doesn't
+ * touch names. Renamed nodes leave unused bytes in the arena, it is
+ * compacted once they outweigh the names in use.
+ */
+class NodeTable {
+    std::vector<std::uint32_t> m_ids;
+    std::vector<std::uint32_t> m_xs;
+    std::vector<std::uint32_t> m_ys;
+    std::vector<std::uint32_t> m_nameOffsets;
+    std::vector<std::uint32_t> m_nameSizes;
+    std::string                m_names;
+    std::size_t                m_unusedSize {0};
+
+    private:
+        void compactNames(void) noexcept {
+            std::string names;
+            names.reserve(m_names.size() - m_unusedSize);
+
+            for (std::size_t i = 0; i < size(); i++) {
+                auto offset = static_cast<std::uint32_t>(names.size());
+                names.append(name(i));
+                m_nameOffsets[i] = offset;
+            }
+
+            m_names      = std::move(names);
+            m_unusedSize = 0;
+        }
+
+    public:
+        std::size_t size(void) const noexcept {
+            return m_ids.size();
+        }
+
+        bool empty(void) const noexcept {
+            return m_ids.empty();
+        }
+
+        void reserve(std::size_t size) noexcept {
+            m_ids.reserve(size);
+            m_xs.reserve(size);
+            m_ys.reserve(size);
+            m_nameOffsets.reserve(size);
+            m_nameSizes.reserve(size);
+        }
+
+        /**
+         * @brief Resize table, added nodes are zeroed & unnamed.
+         *
+         * @param [in] size - given node count.
+         */
+        void resize(std::size_t size) noexcept {
+            for (auto i = size; i < this->size(); i++)
+                m_unusedSize += m_nameSizes[i];
+
+            m_ids.resize(size, 0);
+            m_xs.resize(size, 0);
+            m_ys.resize(size, 0);
+            m_nameSizes.resize(size, 0);
+            m_nameOffsets.resize(size, static_cast<std::uint32_t>(m_names.size()));
+        }
+
+        void push_back(const Node& node) noexcept {
+            m_ids.push_back(node.m_id);
+            m_xs.push_back(node.m_x);
+            m_ys.push_back(node.m_y);
+            m_nameOffsets.push_back(static_cast<std::uint32_t>(m_names.size()));
+            m_nameSizes.push_back(static_cast<std::uint32_t>(node.m_name.size()));
+            m_names.append(node.m_name);
+        }
+
+        std::uint32_t id(std::size_t node) const noexcept {
+            return m_ids[node];
+        }
+
+        std::uint32_t x(std::size_t node) const noexcept {
+            return m_xs[node];
+        }
+
+        std::uint32_t y(std::size_t node) const noexcept {
+            return m_ys[node];
+        }
+
+        std::string_view name(std::size_t node) const noexcept {
+            return std::string_view(m_names).substr(m_nameOffsets[node], m_nameSizes[node]);
+        }
+
+        const std::vector<std::uint32_t>& ids(void) const noexcept {
+            return m_ids;
+        }
+
+        const std::vector<std::uint32_t>& xs(void) const noexcept {
+            return m_xs;
+        }
+
+        const std::vector<std::uint32_t>& ys(void) const noexcept {
+            return m_ys;
+        }
+
+        /**
+         * @brief Get copy of node with all its fields.
+         *
+         * @param [in] node - given node position.
+         * @return node.
+         */
+        Node node(std::size_t node) const noexcept {
+            return {std::string(name(node)), m_ids[node], m_xs[node], m_ys[node]};
+        }
+
+        void setPosition(std::size_t node, std::uint32_t x, std::uint32_t y) noexcept {
+            m_xs[node] = x;
+            m_ys[node] = y;
+        }
+
+        /**
+         * @brief Rename node.
+         *
+         * Name that fits into the old one is written in place,
+         * otherwise it is appended to the arena.
+         *
+         * @param [in] node - given node position.
+         * @param [in] name - given node name.
+         */
+        void setName(std::size_t node, const std::string_view& name) noexcept {
+            auto& offset = m_nameOffsets[node];
+            auto& size   = m_nameSizes[node];
+
+            if (name.size() > size) {
+                m_unusedSize += size;
+                offset        = static_cast<std::uint32_t>(m_names.size());
+                m_names.append(name);
+            }
+            else {
+                m_unusedSize += size - name.size();
+                m_names.replace(offset, name.size(), name);
+            }
+
+            size = static_cast<std::uint32_t>(name.size());
+
+            if (m_unusedSize > m_names.size() / 2)
+                compactNames();
+        }
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_NODE_TABLE_HPP
@@ -20,6 +20,7 @@
 #define NET_DESIGN_NODE_VIEW_HPP
 
 #include <QtWidgets/QTableWidget>
+#include <QtWidgets/QTableView>
 #include <QtWidgets/QVBoxLayout>
 #include <QtWidgets/QPushButton>
 #include <QtWidgets/QLineEdit>
@@ -38,7 +39,7 @@ class NodeView : public QObject
     public:
         QWidget      *m_mainWidget;
         QTableWidget *m_nodeTable;
-        QTableWidget *m_matrixTable;
+        QTableView   *m_matrixTable;
         QPushButton  *m_submitButton;
         QPushButton  *m_saveButton;
         QLineEdit    *m_lineEdit;
@@ -0,0 +1,171 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_PATH_WORKSPACE_HPP
+#define NET_DESIGN_PATH_WORKSPACE_HPP
+
+#include <NetDesign/PriorityQueue.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <span>
+
+
+namespace netd {
+
+using Distance = std::uint64_t;
+
+constexpr std::uint32_t NO_ARC {std::numeric_limits<std::uint32_t>::max()};
+
+// relaxation of node requested by delta-stepping
+struct PathRequest {
+    Distance      m_distance;
+    std::uint32_t m_node;
+    std::uint32_t m_predecessor;
+    std::uint32_t m_arc;
+};
+
+/**
+ * @brief Reusable buffers of shortest path search.
+ *
+ * Buffers are kept between searches, so repeated searches on the same
+ * graph don't allocate. Instead of refilling distances, each search
+ * starts a new generation & node distances are valid only if they were
+ * stamped with it.
+ */
+class PathWorkspace {
+    using Buckets = std::vector<std::vector<std::uint32_t>>;
+
+    std::vector<Distance>                  m_distances;
+    std::vector<std::uint32_t>             m_predecessors;
+    std::vector<std::uint32_t>             m_predecessorArcs;
+    std::vector<std::uint32_t>             m_generations;
+    std::vector<std::uint32_t>             m_path;
+    PriorityQueue<Distance, std::uint32_t> m_queue;
+    std::uint32_t                          m_generation {0};
+
+    // delta-stepping buffers, buckets & requests are split between threads
+    std::vector<Buckets>                   m_buckets;
+    std::vector<std::vector<PathRequest>>  m_requests;
+    std::vector<std::size_t>               m_pushCounts;
+    std::vector<std::uint32_t>             m_frontier;
+    std::vector<std::uint32_t>             m_settled;
+    std::vector<std::uint32_t>             m_frontierMarks;
+    std::vector<std::uint32_t>             m_settledMarks;
+    std::uint32_t                          m_frontierRound {0};
+    std::uint32_t                          m_settledRound {0};
+
+    friend class NetworkGraph;
+
+    private:
+        void reach(std::uint32_t node, Distance distance, std::uint32_t predecessor, std::uint32_t arc) noexcept {
+            m_distances[node]       = distance;
+            m_predecessors[node]    = predecessor;
+            m_predecessorArcs[node] = arc;
+            m_generations[node]     = m_generation;
+        }
+
+    public:
+        /**
+         * @brief Start new search.
+         *
+         * @param [in] nodeCount - given number of graph nodes.
+         */
+        void reset(std::size_t nodeCount) noexcept {
+            if (m_generations.size() != nodeCount) {
+                m_distances.resize(nodeCount);
+                m_predecessors.resize(nodeCount);
+                m_predecessorArcs.resize(nodeCount);
+                m_generations.assign(nodeCount, 0);
+                m_generation = 0;
+            }
+
+            // stamps are cleared only when generation counter wraps
+            if (++m_generation == 0) {
+                std::fill(m_generations.begin(), m_generations.end(), 0);
+                m_generation = 1;
+            }
+
+            m_queue.clear();
+        }
+
+        bool isReached(std::size_t node) const noexcept {
+            return m_generations[node] == m_generation;
+        }
+
+        /**
+         * @brief Get distance of node reached by the last search.
+         *
+         * @param [in] node - given node position.
+         * @return distance from source node.
+         */
+        Distance distance(std::size_t node) const noexcept {
+            return m_distances[node];
+        }
+
+        /**
+         * @brief Get previous node of the shortest path to node.
+         *
+         * @param [in] node - given reached node position.
+         * @return predecessor position, source node is its own predecessor.
+         */
+        std::uint32_t predecessor(std::size_t node) const noexcept {
+            return m_predecessors[node];
+        }
+
+        /**
+         * @brief Get arc of the shortest path to node.
+         *
+         * Arc tells which of parallel edges between node & its predecessor
+         * the path takes.
+         *
+         * @param [in] node - given reached node position.
+         * @return arc from predecessor, NO_ARC for source node.
+         */
+        std::uint32_t predecessorArc(std::size_t node) const noexcept {
+            return m_predecessorArcs[node];
+        }
+
+        /**
+         * @brief Get the shortest path to reached node.
+         *
+         * View is valid until the next search or path request.
+         *
+         * @param [in] dest - given reached node position.
+         * @return node positions from source to destination.
+         */
+        std::span<const std::uint32_t> path(std::size_t dest) noexcept {
+            m_path.clear();
+
+            auto node = static_cast<std::uint32_t>(dest);
+            m_path.push_back(node);
+
+            while (m_predecessors[node] != node) {
+                node = m_predecessors[node];
+                m_path.push_back(node);
+            }
+
+            std::reverse(m_path.begin(), m_path.end());
+            return m_path;
+        }
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_PATH_WORKSPACE_HPP
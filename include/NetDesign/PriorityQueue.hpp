@@ -0,0 +1,153 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_PRIORITY_QUEUE_HPP
+#define NET_DESIGN_PRIORITY_QUEUE_HPP
+
+#include <functional>
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <utility>
+#include <limits>
+#include <vector>
+#include <array>
+#include <bit>
+
+
+namespace netd {
+
+/**
+ * @brief Min-priority queue of binary heap.
+ *
+ * Generic queue for keys that aren't unsigned integers.
+ */
+template<typename Key, typename Value>
+class BinaryHeap {
+    using Entry = std::pair<Key, Value>;
+
+    std::vector<Entry> m_entries;
+
+    public:
+        bool empty(void) const noexcept {
+            return m_entries.empty();
+        }
+
+        void clear(void) noexcept {
+            m_entries.clear();
+        }
+
+        void push(Key key, Value value) noexcept {
+            m_entries.push_back({key, value});
+            std::push_heap(m_entries.begin(), m_entries.end(), std::greater<>());
+        }
+
+        Entry pop(void) noexcept {
+            std::pop_heap(m_entries.begin(), m_entries.end(), std::greater<>());
+
+            auto entry = m_entries.back();
+            m_entries.pop_back();
+
+            return entry;
+        }
+};
+
+/**
+ * @brief Monotone min-priority queue of unsigned integer keys.
+ *
+ * Entry is kept in bucket of the highest bit in which its key differs
+ * from the last popped key. When the lowest bucket runs out, the next
+ * bucket is split into lower ones, so each entry moves at most once
+ * per key bit, without comparisons between buckets.
+ * Pushed key must not be less than the last popped key.
+ */
+template<std::unsigned_integral Key, typename Value>
+class RadixHeap {
+    using Entry = std::pair<Key, Value>;
+
+    static constexpr std::size_t BUCKET_COUNT {std::numeric_limits<Key>::digits + 1};
+
+    std::array<std::vector<Entry>, BUCKET_COUNT> m_buckets;
+    std::size_t                                  m_size {0};
+    Key                                          m_last {0};
+
+    private:
+        std::size_t getBucket(Key key) const noexcept {
+            return static_cast<std::size_t>(std::bit_width(static_cast<Key>(key ^ m_last)));
+        }
+
+    public:
+        bool empty(void) const noexcept {
+            return m_size == 0;
+        }
+
+        void clear(void) noexcept {
+            for (auto& bucket : m_buckets)
+                bucket.clear();
+
+            m_size = 0;
+            m_last = 0;
+        }
+
+        void push(Key key, Value value) noexcept {
+            m_buckets[getBucket(key)].push_back({key, value});
+            m_size++;
+        }
+
+        Entry pop(void) noexcept {
+            if (m_buckets[0].empty()) {
+                std::size_t i {1};
+
+                while (m_buckets[i].empty())
+                    i++;
+
+                auto& bucket = m_buckets[i];
+                m_last       = std::min_element(bucket.begin(), bucket.end())->first;
+
+                // entries of bucket go to lower buckets relative to new minimum
+                for (const auto& entry : bucket)
+                    m_buckets[getBucket(entry.first)].push_back(entry);
+
+                bucket.clear();
+            }
+
+            auto entry = m_buckets[0].back();
+            m_buckets[0].pop_back();
+            m_size--;
+
+            return entry;
+        }
+};
+
+template<typename Key, typename Value>
+struct PriorityQueueType {
+    using Type = BinaryHeap<Key, Value>;
+};
+
+template<std::unsigned_integral Key, typename Value>
+struct PriorityQueueType<Key, Value> {
+    using Type = RadixHeap<Key, Value>;
+};
+
+/** @brief Radix heap for unsigned integer keys, binary heap otherwise.*/
+template<typename Key, typename Value>
+using PriorityQueue = typename PriorityQueueType<Key, Value>::Type;
+
+} // namespace netd
+
+#endif // NET_DESIGN_PRIORITY_QUEUE_HPP
@@ -0,0 +1,119 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_PROJECT_HPP
+#define NET_DESIGN_PROJECT_HPP
+
+#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/ProjectJournal.hpp>
+#include <NetDesign/ProjectParser.hpp>
+#include <NetDesign/ProjectWriter.hpp>
+#include <string_view>
+#include <vector>
+
+
+namespace netd {
+
+/**
+ * @brief Opened project: context together with its section loader & journal.
+ *
+ * Projects are independent of each other, so several of them can be edited
+ * at once. Worker threads get immutable snapshot of context instead of
+ * sharing it with the editor. Previous versions of context are kept for
+ * undo & redo, they share unchanged sections with each other.
+ */
+class Project {
+    public:
+        ProjectContext m_context;
+        ProjectJournal m_journal {m_context};
+
+    private:
+        std::vector<ProjectContext> m_undoVersions;
+        std::vector<ProjectContext> m_redoVersions;
+
+        // parser is destroyed before context it loads sections into
+        ProjectParser m_parser;
+        ProjectWriter m_writer;
+
+        /**
+         * @brief Replace context with other version & journal changed sections.
+         *
+         * @param [in] version - given project version.
+         */
+        void restore(ProjectContext&& version) noexcept;
+        void appendLoadMatrix(const LoadMatrix& previous) noexcept;
+
+    public:
+        Project(void) noexcept = default;
+        Project(const Project&) = delete;
+        Project& operator=(const Project&) = delete;
+
+        /**
+         * @brief Open project file & start journaling its edits.
+         *
+         * @param [in] filename - given project file name.
+         * @return true if project was opened successfully, false otherwise.
+         */
+        bool open(const std::string_view& filename) noexcept;
+
+        /**
+         * @brief Save full project snapshot & drop its journal.
+         *
+         * @return true if project was saved successfully, false otherwise.
+         */
+        bool save(void) noexcept;
+
+        /**
+         * @brief Remember current version of project for undo.
+         *
+         * Must be called before sections are edited.
+         */
+        void checkpoint(void) noexcept;
+
+        /**
+         * @brief Return to version of project before the last edit.
+         *
+         * @return true if edit was undone, false otherwise.
+         */
+        bool undo(void) noexcept;
+
+        /**
+         * @brief Return to version of project before the last undo.
+         *
+         * @return true if edit was redone, false otherwise.
+         */
+        bool redo(void) noexcept;
+
+        /**
+         * @brief Drop edits made since the last checkpoint, they can't be redone.
+         *
+         * Used when edit fails halfway, so its partial result is never journaled.
+         */
+        void discard(void) noexcept;
+
+        /**
+         * @brief Check whether project has no file & no content.
+         *
+         * @return true if project is empty, false otherwise.
+         */
+        bool isEmpty(void) const noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_PROJECT_HPP
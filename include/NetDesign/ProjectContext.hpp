@@ -19,37 +19,161 @@
 #ifndef NET_DESIGN_PROJECT_CONTEXT_HPP
 #define NET_DESIGN_PROJECT_CONTEXT_HPP
 
-#include <boost/numeric/ublas/matrix.hpp>
+#include <NetDesign/SectionIndex.hpp>
+#include <NetDesign/LoadMatrix.hpp>
+#include <NetDesign/NodeTable.hpp>
+#include <NetDesign/EdgeTable.hpp>
 #include <NetDesign/Channel.hpp>
+#include <NetDesign/Section.hpp>
 #include <NetDesign/Router.hpp>
 #include <NetDesign/Node.hpp>
+#include <initializer_list>
+#include <string_view>
+#include <optional>
+#include <memory>
 #include <vector>
 
 
 namespace netd {
 
-namespace ublas = boost::numeric::ublas;
-using Matrix    = ublas::matrix<std::uint32_t>;
+using NodeIndex    = SectionIndex<NodeTable, std::string, &NodeTable::name>;
+using ChannelIndex = SectionIndex<std::vector<Channel>, std::uint32_t, &Channel::m_capacity>;
 
+/**
+ * @brief Project data.
+ *
+ * Sections are copy-on-write, so copy of context is a cheap immutable
+ * version of project, sharing unchanged sections with other versions.
+ * Sections are read with "*" or "->" & modified with edit().
+ */
 class ProjectContext {
-    private:
+    public:
+        Shared<std::vector<Channel>>       m_channels;
+        Shared<std::vector<Router>>        m_routers;
+        Shared<NodeTable>                  m_nodes;
+        std::uint32_t                      m_packetSize {0};
+        std::string                        m_filename;
+        LoadMatrix                         m_loadMatrix;
+        Shared<EdgeTable>                  m_edgeTable;
+
+        // sum of load matrix rows, available without loading the matrix
+        Shared<std::vector<std::uint32_t>> m_nodeLoads;
+        std::array<bool, SECTION_COUNT>    m_isLoaded {};
+        SectionLoader                      *m_loader {nullptr};
+
+        // lookup of node by name & channel by capacity
+        NodeIndex                          m_nodeIndex;
+        ChannelIndex                       m_channelIndex;
+
         ProjectContext(void) noexcept = default;
 
-    public:
-        std::vector<Channel>  m_channels;
-        std::vector<Router>   m_routers;
-        std::vector<Node>     m_nodes;
-        std::uint32_t         m_packetSize;
-        std::string           m_filename;
-        Matrix                m_loadMatrix;
-        Matrix                m_edgeTable;
-
-        static ProjectContext& instance(void) noexcept {
-            static ProjectContext instance;
-            return instance;
+        /**
+         * @brief Make sure that section is loaded from project file.
+         *
+         * @param [in] section - given project section.
+         */
+        void require(Section section) noexcept {
+            auto& isLoaded = m_isLoaded[static_cast<std::size_t>(section)];
+
+            if (!isLoaded && m_loader)
+                m_loader->load(section);
+
+            isLoaded = true;
+        }
+
+        /** @brief Make sure that all sections are loaded from project file.*/
+        void requireAll(void) noexcept {
+            for (std::size_t i = 0; i < SECTION_COUNT; i++)
+                require(static_cast<Section>(i));
+        }
+
+        /**
+         * @brief Get immutable copy of project for worker threads.
+         *
+         * All sections are loaded first, so copy doesn't depend on
+         * project file or its loader. Sections are shared with context
+         * until they are edited.
+         *
+         * @return project snapshot.
+         */
+        std::shared_ptr<const ProjectContext> snapshot(void) noexcept {
+            requireAll();
+
+            auto copy      = std::make_shared<ProjectContext>(*this);
+            copy->m_loader = nullptr;
+
+            return copy;
+        }
+
+        /**
+         * @brief Get immutable copy of project with given sections loaded.
+         *
+         * Other sections are loaded only if they were loaded before, they
+         * must not be read from copy. Node loads are always available.
+         *
+         * @param [in] sections - given sections read by worker.
+         * @return project snapshot.
+         */
+        std::shared_ptr<const ProjectContext> snapshot(std::initializer_list<Section> sections) noexcept {
+            for (auto section : sections)
+                require(section);
+
+            auto copy      = std::make_shared<ProjectContext>(*this);
+            copy->m_loader = nullptr;
+
+            return copy;
+        }
+
+        /** @brief Update lookup indexes after nodes or channels change.*/
+        void updateIndexes(void) noexcept {
+            m_nodeIndex.update(m_nodes);
+            m_channelIndex.update(m_channels);
+        }
+
+        /**
+         * @brief Find the first node with given name.
+         *
+         * @param [in] name - given node name.
+         * @return node position if it was found, std::nullopt otherwise.
+         */
+        std::optional<std::uint32_t> findNode(const std::string_view& name) const noexcept {
+            return m_nodeIndex.find(m_nodes, name);
+        }
+
+        /**
+         * @brief Find the first channel with given capacity.
+         *
+         * @param [in] capacity - given channel capacity.
+         * @return channel position if it was found, std::nullopt otherwise.
+         */
+        std::optional<std::uint32_t> findChannel(std::uint32_t capacity) const noexcept {
+            return m_channelIndex.find(m_channels, capacity);
+        }
+
+        /** @brief Recalculate node loads after load matrix change.*/
+        void updateNodeLoads(void) noexcept {
+            auto& nodeLoads = m_nodeLoads.edit();
+            nodeLoads.assign(m_loadMatrix.size1(), 0);
+
+            for (std::size_t i = 0; i < m_loadMatrix.size1(); i++) {
+                auto row = m_loadMatrix.row(i);
+
+                for (std::size_t j = 0; j < m_loadMatrix.size2(); j++)
+                    nodeLoads[i] += row[j];
+            }
+        }
+
+        /**
+         * @brief Get total load of node.
+         *
+         * @param [in] node - given node position.
+         * @return sum of node load matrix row.
+         */
+        std::uint32_t nodeLoad(std::size_t node) const noexcept {
+            return (node < m_nodeLoads->size()) ? (*m_nodeLoads)[node] : 0;
         }
 };
 
 } // namespace netd
 
-#endif // NET_DESIGN_PROJECT_CONTEXT_HPP
\ No newline at end of file
+#endif // NET_DESIGN_PROJECT_CONTEXT_HPP
@@ -19,7 +19,8 @@
 #ifndef NET_DESIGN_PROJECT_CONTROLLER_HPP
 #define NET_DESIGN_PROJECT_CONTROLLER_HPP
 
-#include <NetDesign/ProjectParser.hpp>
+#include <NetDesign/TopologyParser.hpp>
+#include <NetDesign/TopologyWriter.hpp>
 #include <string>
 
 
@@ -28,7 +29,8 @@ namespace netd {
 class ProjectController
 {
     private:
-        ProjectParser m_parser;
+        TopologyParser m_topologyParser;
+        TopologyWriter m_topologyWriter;
 
     public:
         ProjectController(void) noexcept = default;
@@ -42,8 +44,20 @@ class ProjectController
         /** @brief Save action handler.*/
         void saveProject(void) noexcept;
 
+        /** @brief Import Topology action handler.*/
+        void importTopology(void) noexcept;
+
+        /** @brief Export Topology action handler.*/
+        void exportTopology(void) noexcept;
+
         /** @brief Exit action handler.*/
         void exitProject(void) noexcept;
+
+        /** @brief Undo action handler.*/
+        void undoEdit(void) noexcept;
+
+        /** @brief Redo action handler.*/
+        void redoEdit(void) noexcept;
 };
 
 } // namespace netd
@@ -0,0 +1,76 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_PROJECT_INDEX_HPP
+#define NET_DESIGN_PROJECT_INDEX_HPP
+
+#include <NetDesign/Section.hpp>
+#include <string_view>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace netd {
+
+/**
+ * @brief Section offset index of project file.
+ *
+ * Index is cached next to the project file (<project>.ndidx) and is
+ * valid only while project file size & modification time match.
+ * It also keeps node loads (sums of load matrix rows), so delay
+ * computations don't need the load matrix itself.
+ */
+class ProjectIndex {
+    public:
+        std::array<std::int64_t, SECTION_COUNT> m_offsets;
+        std::vector<std::uint32_t>              m_nodeLoads;
+
+        ProjectIndex(void) noexcept;
+
+        /** @brief Forget all section offsets & node loads.*/
+        void clear(void) noexcept;
+
+        /**
+         * @brief Load cached index of project file.
+         *
+         * @param [in] filename - given project file name.
+         * @return true if index exists and is up to date, false otherwise.
+         */
+        bool load(const std::string_view& filename) noexcept;
+
+        /**
+         * @brief Cache index of project file.
+         *
+         * @param [in] filename - given project file name.
+         * @return true if index was saved successfully, false otherwise.
+         */
+        bool save(const std::string_view& filename) const noexcept;
+
+        /**
+         * @brief Get index file name of project.
+         *
+         * @param [in] filename - given project file name.
+         * @return index file name.
+         */
+        static std::string getPath(const std::string_view& filename) noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_PROJECT_INDEX_HPP
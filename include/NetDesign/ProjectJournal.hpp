@@ -0,0 +1,145 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_PROJECT_JOURNAL_HPP
+#define NET_DESIGN_PROJECT_JOURNAL_HPP
+
+#include <NetDesign/ProjectContext.hpp>
+#include <string_view>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+
+namespace netd {
+
+constexpr std::string_view LOAD_CELLS_NAME {"# Load Cells"};
+constexpr std::string_view COMMIT_NAME     {"# Commit"};
+
+struct LoadCell {
+    std::uint32_t m_row;
+    std::uint32_t m_column;
+    std::uint32_t m_value;
+};
+
+/**
+ * @brief Append-only journal of project edits.
+ *
+ * Journal (<project>.ndjournal) stores edited sections in project file
+ * format, each record is terminated by "# Commit" line and synced to disk,
+ * so small edits cost a few bytes of I/O and survive a crash. When journal
+ * grows too large, it is compacted into full project snapshot in background.
+ */
+class ProjectJournal {
+    std::atomic<bool> m_isCompacting {false};
+    std::thread       m_compactor;
+    std::string       m_project;
+    std::string       m_buffer;
+    std::uint64_t     m_size {0};
+    std::int32_t      m_fd {-1};
+    bool              m_isBroken {false};
+    ProjectContext    *m_context;
+
+    private:
+        void putSection(Section section, std::size_t count) noexcept;
+        void put(const std::string_view& str) noexcept;
+        void put(std::uint64_t value) noexcept;
+        bool commit(void) noexcept;
+        void compact(void) noexcept;
+        void wait(void) noexcept;
+
+    public:
+        /**
+         * @brief Construct journal of project.
+         *
+         * @param [in] context - given project context, snapshot of it is
+         * saved when journal is compacted.
+         */
+        explicit ProjectJournal(ProjectContext& context) noexcept : m_context(&context) {}
+        ProjectJournal(const ProjectJournal&) = delete;
+        ProjectJournal& operator=(const ProjectJournal&) = delete;
+        ~ProjectJournal(void) noexcept;
+
+        /**
+         * @brief Start journaling edits of project.
+         *
+         * Project context must match project file & its journal.
+         *
+         * @param [in] filename - given project file name.
+         */
+        void open(const std::string_view& filename) noexcept;
+
+        /** @brief Stop journaling edits.*/
+        void close(void) noexcept;
+
+        /**
+         * @brief Drop journal after full project snapshot was saved.
+         *
+         * @param [in] filename - given project file name.
+         */
+        void reset(const std::string_view& filename) noexcept;
+
+        /**
+         * @brief Check whether journaling failed.
+         *
+         * Failed record is cut off & journal is closed, so edits made
+         * since then are kept only if project is saved in full.
+         *
+         * @return true if edits are no longer journaled, false otherwise.
+         */
+        bool isBroken(void) const noexcept;
+
+        // append functions return false if record couldn't be journaled
+        bool appendNodes(const NodeTable& nodes) noexcept;
+        bool appendRouters(const std::vector<Router>& routers) noexcept;
+        bool appendChannels(const std::vector<Channel>& channels) noexcept;
+        bool appendEdgeTable(const EdgeTable& edgeTable) noexcept;
+        bool appendPacketSize(std::uint32_t packetSize) noexcept;
+
+        /**
+         * @brief Append load matrix cells change.
+         *
+         * @param [in] size - given load matrix size.
+         * @param [in] isCleared - given flag whether matrix was resized & cleared.
+         * @param [in] cells - given changed load matrix cells.
+         * @return true if cells were journaled, false otherwise.
+         */
+        bool appendLoadCells(std::size_t size, bool isCleared, const std::vector<LoadCell>& cells) noexcept;
+
+        /**
+         * @brief Get journal file name of project.
+         *
+         * @param [in] filename - given project file name.
+         * @return journal file name.
+         */
+        static std::string getPath(const std::string_view& filename) noexcept;
+
+        /**
+         * @brief Get file name of journal being compacted.
+         *
+         * @param [in] filename - given project file name.
+         * @return compacted journal file name.
+         */
+        static std::string getOldPath(const std::string_view& filename) noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_PROJECT_JOURNAL_HPP
@@ -19,6 +19,9 @@
 #ifndef NET_DESIGN_PROJECT_PARSER_HPP
 #define NET_DESIGN_PROJECT_PARSER_HPP
 
+#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/ProjectIndex.hpp>
+#include <NetDesign/Compression.hpp>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -26,21 +29,54 @@
 
 namespace netd {
 
-class ProjectParser {
+class ProjectParser : public SectionLoader {
+    DecompressBuffer   m_decompressBuffer;
+    ProjectIndex       m_index;
+    std::filebuf       m_fileBuffer;
     std::istringstream m_iss;
-    std::ifstream      m_file;
+    std::istream       m_file {nullptr};
     std::string        m_line;
+    ProjectContext     *m_context {nullptr};
 
     private:
         std::uint32_t parseCount(void) noexcept;
+        void parseSection(void) noexcept;
         void parseNodes(void) noexcept;
         void parseLoadMatrix(void) noexcept;
         void parseEdgeTable(void) noexcept;
         void parseRouters(void) noexcept;
         void parseChannels(void) noexcept;
+        void parseLoadCells(void) noexcept;
+        void buildIndex(void) noexcept;
+
+        /**
+         * @brief Apply committed records of project journal.
+         *
+         * @param [in] filename - given journal file name.
+         */
+        void replay(const std::string& filename) noexcept;
 
     public:
-        void parse(const std::string_view& filename) noexcept;
+        ~ProjectParser(void) noexcept override;
+
+        /**
+         * @brief Open project file.
+         *
+         * Plain project files are indexed and their sections are loaded
+         * on demand, compressed project files are parsed at once.
+         *
+         * @param [out] context - given project context.
+         * @param [in] filename - given project file name.
+         * @return true if project was opened successfully, false otherwise.
+         */
+        bool parse(ProjectContext& context, const std::string_view& filename) noexcept;
+
+        /**
+         * @brief Load project section from opened project file.
+         *
+         * @param [in] section - given project section.
+         */
+        void load(Section section) noexcept override;
 };
 
 } // namespace netd
@@ -0,0 +1,83 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_PROJECT_WRITER_HPP
+#define NET_DESIGN_PROJECT_WRITER_HPP
+
+#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/ProjectIndex.hpp>
+#include <NetDesign/Compression.hpp>
+#include <string_view>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+namespace netd {
+
+/**
+ * @brief Serializes project context into .ndproj file.
+ *
+ * Fields are formatted with std::to_chars into reusable buffers which
+ * are flushed with large writes. Load matrix rows are formatted in parallel.
+ * Data is written into uniquely named temporary file which is renamed
+ * over the target only after successful write & its directory is synced,
+ * so crash never leaves a truncated project & overlapping saves don't collide.
+ * Files with .gz or .zst extension are compressed while being written,
+ * plain files also get section offset index cached next to them.
+ */
+class ProjectWriter {
+    boost::iostreams::filtering_ostream m_stream;
+    std::vector<std::string>            m_rowBuffers;
+    std::string                         m_buffer;
+    const ProjectContext                *m_context {nullptr};
+    ProjectIndex                        m_index;
+    std::FILE                           *m_file {nullptr};
+    std::int64_t                        m_offset {0};
+    bool                                m_isOk {true};
+
+    private:
+        void putSection(Section section) noexcept;
+        void put(const std::string_view& str) noexcept;
+        void put(std::uint64_t value) noexcept;
+        void write(const std::string_view& data) noexcept;
+        void flush(void) noexcept;
+
+        void writeNodes(void) noexcept;
+        void writeLoadMatrix(void) noexcept;
+        void writeEdgeTable(void) noexcept;
+        void writeRouters(void) noexcept;
+        void writeChannels(void) noexcept;
+
+    public:
+        /**
+         * @brief Save project context.
+         *
+         * All project sections must be loaded before saving.
+         *
+         * @param [in] context - given project context.
+         * @param [in] filename - given project file name.
+         * @return true if project was saved successfully, false otherwise.
+         */
+        bool save(const ProjectContext& context, const std::string_view& filename) noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_PROJECT_WRITER_HPP
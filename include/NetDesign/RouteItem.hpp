@@ -0,0 +1,61 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_ROUTE_ITEM_HPP
+#define NET_DESIGN_ROUTE_ITEM_HPP
+
+#include <QtWidgets/QGraphicsItem>
+#include <QtGui/QColor>
+#include <cstdint>
+#include <vector>
+
+
+namespace netd {
+
+/**
+ * @brief Scene item highlighting route & its alternatives.
+ *
+ * Routes are drawn over edge tiles, each route by a single call.
+ * Alternatives are dashed & drawn under the chosen route, lines keep
+ * a few pixels width when zoomed out, so route stays visible.
+ */
+class RouteItem : public QGraphicsItem {
+    std::vector<QLineF>      m_lines;
+    std::vector<std::size_t> m_offsets; // lines of route are [m_offsets[route], m_offsets[route + 1])
+    QRectF                   m_bounds;
+
+    public:
+        RouteItem(void) noexcept;
+
+        /**
+         * @brief Set highlighted routes.
+         *
+         * @param [in] lines - given lines of all routes, the chosen route first.
+         * @param [in] offsets - given offsets of route lines & total line count after them.
+         */
+        void setRoutes(std::vector<QLineF> lines, std::vector<std::size_t> offsets) noexcept;
+
+        static QColor getRouteColor(std::size_t route) noexcept;
+
+        QRectF boundingRect(void) const override;
+        void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) override;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_ROUTE_ITEM_HPP
@@ -20,6 +20,7 @@
 #define NET_DESIGN_ROUTER_CONTROLLER_HPP
 
 #include <NetDesign/RouterView.hpp>
+#include <NetDesign/Project.hpp>
 
 
 namespace netd {
@@ -27,9 +28,10 @@ namespace netd {
 class RouterController : public QObject
 {
     RouterView *m_routerView;
+    Project    *m_project;
 
     public:
-        RouterController(RouterView *routerView) noexcept;
+        RouterController(Project& project, RouterView *routerView) noexcept;
         void updateContent(void) noexcept;
 
     private:
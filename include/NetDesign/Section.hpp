@@ -0,0 +1,64 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_SECTION_HPP
+#define NET_DESIGN_SECTION_HPP
+
+#include <string_view>
+#include <cstdint>
+#include <array>
+
+
+namespace netd {
+
+enum class Section : std::uint8_t {
+    Nodes,
+    LoadMatrix,
+    EdgeTable,
+    Routers,
+    Channels,
+    PacketSize,
+};
+
+constexpr std::size_t SECTION_COUNT {6};
+
+constexpr std::array<std::string_view, SECTION_COUNT> SECTION_NAMES {
+    "# Nodes",
+    "# Load Matrix",
+    "# Edge Table",
+    "# Routers",
+    "# Channels",
+    "# Packet Size",
+};
+
+/** @brief Loads project sections on demand.*/
+class SectionLoader {
+    public:
+        virtual ~SectionLoader(void) noexcept = default;
+
+        /**
+         * @brief Load project section into project context.
+         *
+         * @param [in] section - given project section.
+         */
+        virtual void load(Section section) noexcept = 0;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_SECTION_HPP
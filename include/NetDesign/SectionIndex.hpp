@@ -0,0 +1,235 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_SECTION_INDEX_HPP
+#define NET_DESIGN_SECTION_INDEX_HPP
+
+#include <NetDesign/Shared.hpp>
+#include <unordered_set>
+#include <string_view>
+#include <functional>
+#include <algorithm>
+#include <type_traits>
+#include <concepts>
+#include <optional>
+#include <memory>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace netd {
+
+/**
+ * @brief Hash index from field of section elements to their positions.
+ *
+ * Key of element is either its member (vector of structures) or result
+ * of table accessor called with element position (columnar tables).
+ * Index stores positions only, keys are read from indexed version of
+ * section, which index shares, so keys aren't copied. Index is updated
+ * with difference between indexed & current elements, so saving a table
+ * rehashes only changed keys. Duplicated keys refer to the first element,
+ * as linear search would.
+ */
+template<typename Data, typename Key, auto KeyOf>
+class SectionIndex {
+    // string keys are compared as std::string_view into section
+    using KeyView = std::conditional_t<std::same_as<Key, std::string>, std::string_view, Key>;
+
+    struct Slot {
+        std::uint32_t m_position;
+    };
+
+    // slot is hashed & compared by key of its element in indexed section
+    struct Hash {
+        using is_transparent = void;
+
+        const Shared<Data> *m_section;
+
+        std::size_t operator()(const KeyView& key) const noexcept {
+            return std::hash<KeyView>{}(key);
+        }
+
+        std::size_t operator()(const Slot& slot) const noexcept {
+            return (*this)(keyOf(**m_section, slot.m_position));
+        }
+    };
+
+    struct Equal {
+        using is_transparent = void;
+
+        const Shared<Data> *m_section;
+
+        bool operator()(const Slot& a, const Slot& b) const noexcept {
+            return a.m_position == b.m_position;
+        }
+
+        bool operator()(const KeyView& key, const Slot& slot) const noexcept {
+            return keyOf(**m_section, slot.m_position) == key;
+        }
+
+        bool operator()(const Slot& slot, const KeyView& key) const noexcept {
+            return keyOf(**m_section, slot.m_position) == key;
+        }
+    };
+
+    // section is kept on heap, so hash set refers to it after index is moved
+    std::unique_ptr<Shared<Data>>        m_section {std::make_unique<Shared<Data>>()};
+    std::unordered_set<Slot, Hash, Equal> m_positions {0, Hash {m_section.get()}, Equal {m_section.get()}};
+    std::uint64_t                        m_version {0};
+    bool                                 m_hasDuplicates {false};
+
+    private:
+        static KeyView keyOf(const Data& data, std::uint32_t position) noexcept {
+            if constexpr (std::is_member_object_pointer_v<decltype(KeyOf)>)
+                return data[position].*KeyOf;
+            else
+                return std::invoke(KeyOf, data, position);
+        }
+
+        // indexed section must already contain element
+        void insert(std::uint32_t position) noexcept {
+            auto it = m_positions.find(keyOf(**m_section, position));
+
+            if (it == m_positions.end()) {
+                m_positions.insert(Slot {position});
+                return;
+            }
+
+            m_hasDuplicates = true;
+
+            if (position < it->m_position) {
+                m_positions.erase(it);
+                m_positions.insert(Slot {position});
+            }
+        }
+
+        void rebuild(const Shared<Data>& section) noexcept {
+            *m_section = section;
+
+            const auto& data = **m_section;
+
+            m_positions.clear();
+            m_positions.reserve(data.size());
+            m_hasDuplicates = false;
+
+            for (std::uint32_t i = 0; i < data.size(); i++)
+                insert(i);
+        }
+
+    public:
+        SectionIndex(void) noexcept = default;
+        SectionIndex(SectionIndex&&) noexcept = default;
+        SectionIndex& operator=(SectionIndex&&) noexcept = default;
+
+        // index is a cache, so copies of project start without it
+        SectionIndex(const SectionIndex&) noexcept {}
+
+        SectionIndex& operator=(const SectionIndex&) noexcept {
+            *this = SectionIndex();
+            return *this;
+        }
+
+        /**
+         * @brief Check whether index matches section.
+         *
+         * @param [in] section - given section.
+         * @return true if index is up to date, false otherwise.
+         */
+        bool isCurrent(const Shared<Data>& section) const noexcept {
+            return m_version == section.version();
+        }
+
+        /**
+         * @brief Bring index up to date with section.
+         *
+         * @param [in] section - given section.
+         */
+        void update(const Shared<Data>& section) noexcept {
+            if (isCurrent(section))
+                return;
+
+            const auto& oldData = **m_section;
+            const auto& data    = *section;
+            m_version           = section.version();
+
+            // position of duplicated key depends on other elements
+            if (m_hasDuplicates || m_positions.empty()) {
+                rebuild(section);
+                return;
+            }
+
+            auto oldSize = static_cast<std::uint32_t>(oldData.size());
+            auto newSize = static_cast<std::uint32_t>(data.size());
+            auto common  = std::min(oldSize, newSize);
+
+            std::vector<std::uint32_t> changed;
+
+            // keys are erased while old section is indexed, so that swapped keys don't collide
+            for (std::uint32_t i = 0; i < oldSize; i++) {
+                if (i >= common || keyOf(oldData, i) != keyOf(data, i)) {
+                    m_positions.erase(Slot {i});
+
+                    if (i < common)
+                        changed.push_back(i);
+                }
+            }
+
+            *m_section = section;
+
+            for (auto i : changed)
+                insert(i);
+
+            for (auto i = common; i < newSize; i++)
+                insert(i);
+        }
+
+        /**
+         * @brief Find position of the first element with given key.
+         *
+         * Index is used if it is up to date, otherwise elements are searched.
+         *
+         * @param [in] section - given section.
+         * @param [in] key - given key.
+         * @return element position if it was found, std::nullopt otherwise.
+         */
+        template<typename K>
+        std::optional<std::uint32_t> find(const Shared<Data>& section, const K& key) const noexcept {
+            if (isCurrent(section)) {
+                auto it = m_positions.find(KeyView(key));
+
+                if (it == m_positions.end())
+                    return std::nullopt;
+
+                return it->m_position;
+            }
+
+            const auto& data = *section;
+
+            for (std::uint32_t i = 0; i < data.size(); i++) {
+                if (keyOf(data, i) == key)
+                    return i;
+            }
+
+            return std::nullopt;
+        }
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_SECTION_INDEX_HPP
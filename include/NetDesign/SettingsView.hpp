@@ -27,6 +27,7 @@
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QListWidget>
 #include <QtWidgets/QTabWidget>
+#include <array>
 
 
 namespace netd {
@@ -34,18 +35,22 @@ namespace netd {
 class SettingsView : public QObject
 {
     private:
-        RouterController *m_routerController;
-        NodeController   *m_nodeController;
-        RouterView       *m_routerView;
-        NodeView         *m_nodeView;
-        QHBoxLayout      *m_mainLayout;
-        QStackedWidget   *m_content;
-        QListWidget      *m_list;
+        RouterController    *m_routerController;
+        NodeController      *m_nodeController;
+        RouterView          *m_routerView;
+        NodeView            *m_nodeView;
+        QHBoxLayout         *m_mainLayout;
+        QStackedWidget      *m_content;
+        QListWidget         *m_list;
+        std::array<bool, 2> m_isOutdated {};
+
+        void updatePage(std::int32_t index) noexcept;
 
     public:
         QWidget *m_tab;
 
-        SettingsView(QWidget *parent = nullptr) noexcept;
+        SettingsView(Project& project, QWidget *parent = nullptr) noexcept;
+        ~SettingsView(void) noexcept override;
         void updateContent(void) noexcept;
 };
 
@@ -0,0 +1,102 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_SHARED_HPP
+#define NET_DESIGN_SHARED_HPP
+
+#include <cstdint>
+#include <memory>
+#include <atomic>
+
+
+namespace netd {
+
+/**
+ * @brief Copy-on-write value shared between project versions.
+ *
+ * Copies share the same data, which is cloned only when it is edited
+ * while shared. Each edit gets unique version number, so caches derived
+ * from data can check whether they are still valid.
+ *
+ * Threads: value is edited by thread owning it only. Other threads get
+ * copies from project snapshot they hold, so the owner sees data shared
+ * while they can read it, and they release copies at any time. Data is
+ * edited in place once all other copies were released, acquire fence
+ * makes their reads of data happen before the edit.
+ */
+template<typename T>
+class Shared {
+    std::shared_ptr<T> m_data;
+    std::uint64_t      m_version {nextVersion()};
+
+    static std::uint64_t nextVersion(void) noexcept {
+        static std::atomic<std::uint64_t> counter {0};
+        return ++counter;
+    }
+
+    public:
+        Shared(void) noexcept : m_data(std::make_shared<T>()) {}
+        Shared(T value) noexcept : m_data(std::make_shared<T>(std::move(value))) {}
+
+        const T& operator*(void) const noexcept {
+            return *m_data;
+        }
+
+        const T *operator->(void) const noexcept {
+            return m_data.get();
+        }
+
+        /**
+         * @brief Get data for modification.
+         *
+         * @return data, that is not shared with other versions.
+         */
+        T& edit(void) noexcept {
+            // count is read relaxed, fence pairs with release of the last other copy
+            if (m_data.use_count() > 1)
+                m_data = std::make_shared<T>(*m_data);
+            else
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+            m_version = nextVersion();
+            return *m_data;
+        }
+
+        /**
+         * @brief Get version of data.
+         *
+         * @return number, that changes on every edit of data.
+         */
+        std::uint64_t version(void) const noexcept {
+            return m_version;
+        }
+
+        /**
+         * @brief Check whether data is shared with other value.
+         *
+         * @param [in] other - given other value.
+         * @return true if both values refer to the same data, false otherwise.
+         */
+        bool isSame(const Shared& other) const noexcept {
+            return m_data == other.m_data;
+        }
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_SHARED_HPP
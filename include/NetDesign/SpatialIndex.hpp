@@ -0,0 +1,119 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_SPATIAL_INDEX_HPP
+#define NET_DESIGN_SPATIAL_INDEX_HPP
+
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <NetDesign/EdgeTable.hpp>
+#include <NetDesign/NodeTable.hpp>
+#include <optional>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace netd {
+
+struct SpatialBounds {
+    double m_minX {0.0};
+    double m_minY {0.0};
+    double m_maxX {0.0};
+    double m_maxY {0.0};
+};
+
+/**
+ * @brief R-tree of node positions & edge segments.
+ *
+ * Trees are bulk loaded from node & edge tables, so rebuilding index of
+ * large topology costs a sort instead of an insertion per element. Queries
+ * return node positions & edge table rows, edges referring to missing
+ * nodes aren't indexed.
+ */
+class SpatialIndex {
+    using Point     = boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian>;
+    using Box       = boost::geometry::model::box<Point>;
+    using Segment   = boost::geometry::model::segment<Point>;
+    using NodeValue = std::pair<Point, std::uint32_t>;
+    using EdgeValue = std::pair<Segment, std::uint32_t>;
+    using Params    = boost::geometry::index::rstar<16>;
+
+    boost::geometry::index::rtree<NodeValue, Params> m_nodes;
+    boost::geometry::index::rtree<EdgeValue, Params> m_edges;
+
+    public:
+        /**
+         * @brief Build index of nodes & edges.
+         *
+         * @param [in] nodes - given node table.
+         * @param [in] edgeTable - given edge table.
+         */
+        void set(const NodeTable& nodes, const EdgeTable& edgeTable) noexcept;
+
+        /** @brief Remove all nodes & edges from index.*/
+        void clear(void) noexcept;
+
+        /**
+         * @brief Check whether index has no nodes.
+         *
+         * @return true if index is empty, false otherwise.
+         */
+        bool empty(void) const noexcept;
+
+        /**
+         * @brief Get bounds of all nodes.
+         *
+         * @return bounds, zero if index is empty.
+         */
+        SpatialBounds bounds(void) const noexcept;
+
+        /**
+         * @brief Find node nearest to point.
+         *
+         * @param [in] x - given point x coordinate.
+         * @param [in] y - given point y coordinate.
+         * @param [in] maxDistance - given maximum distance to node.
+         * @return node position if there is node within distance.
+         */
+        std::optional<std::uint32_t> findNode(double x, double y, double maxDistance) const noexcept;
+
+        /**
+         * @brief Find edge nearest to point.
+         *
+         * @param [in] x - given point x coordinate.
+         * @param [in] y - given point y coordinate.
+         * @param [in] maxDistance - given maximum distance to edge segment.
+         * @return edge table row if there is edge within distance.
+         */
+        std::optional<std::uint32_t> findEdge(double x, double y, double maxDistance) const noexcept;
+
+        /**
+         * @brief Find nodes inside bounds.
+         *
+         * @param [in] bounds - given bounds.
+         * @param [out] nodes - given found node positions.
+         */
+        void findNodes(const SpatialBounds& bounds, std::vector<std::uint32_t>& nodes) const noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_SPATIAL_INDEX_HPP
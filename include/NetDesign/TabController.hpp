@@ -23,19 +23,25 @@
 #include <NetDesign/SettingsView.hpp>
 #include <NetDesign/GraphView.hpp>
 #include <NetDesign/TabView.hpp>
+#include <array>
 
 
 namespace netd {
 
 class TabController
 {
-    GraphController *m_graphController;
-    SettingsView    *m_settingsView;
-    GraphView       *m_graphView;
-    TabView         *m_tabView;
+    GraphController     *m_graphController;
+    SettingsView        *m_settingsView;
+    GraphView           *m_graphView;
+    TabView             *m_tabView;
+    std::array<bool, 2> m_isOutdated {};
+
+    private:
+        void updateTab(std::int32_t index) noexcept;
 
     public:
-        TabController(TabView *tabView, QWidget *parent = nullptr) noexcept;
+        TabController(Project& project, TabView *tabView, QWidget *parent = nullptr) noexcept;
+        ~TabController(void) noexcept;
         void addTab(QWidget *tab, const QString& title) noexcept;
         void updateContent(void) noexcept;
 };
@@ -0,0 +1,110 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_TOPOLOGY_PARSER_HPP
+#define NET_DESIGN_TOPOLOGY_PARSER_HPP
+
+#include <NetDesign/ProjectContext.hpp>
+#include <unordered_map>
+#include <string_view>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace netd {
+
+enum class TopologyFormat {
+    GraphML,
+    Gml,
+};
+
+/**
+ * @brief Get topology file format by its extension.
+ *
+ * @param [in] filename - given topology file name.
+ * @return topology format (.gml - GML, otherwise GraphML).
+ */
+TopologyFormat getTopologyFormat(const std::string_view& filename) noexcept;
+
+/**
+ * @brief Streaming importer of GraphML & GML (Topology Zoo) topologies.
+ *
+ * File is read element by element without building a document tree,
+ * so memory usage is bounded by imported nodes, edges & channels.
+ * Channels are created for each distinct edge capacity & price.
+ */
+class TopologyParser {
+    std::unordered_map<std::string, std::uint32_t>   m_nodePositions;
+    std::unordered_map<std::uint64_t, std::uint32_t> m_channelPositions;
+    std::unordered_map<std::string, std::string>     m_keyNames;
+    EdgeTable                                        m_edges;
+    ProjectContext                                   *m_context {nullptr};
+    bool                                             m_isRenamed {false};
+
+    // element being parsed
+    Node          m_node;
+    std::string   m_nodeId;
+    std::string   m_source;
+    std::string   m_target;
+    std::uint32_t m_capacity {0};
+    std::uint32_t m_price {0};
+
+    private:
+        std::uint32_t nodePosition(const std::string& id) noexcept;
+        std::uint32_t channelPosition(void) noexcept;
+        std::string toNodeName(const std::string_view& name) noexcept;
+        void setNodeAttribute(const std::string_view& name, const std::string_view& value) noexcept;
+        void setEdgeAttribute(const std::string_view& name, const std::string_view& value) noexcept;
+        void beginNode(void) noexcept;
+        void endNode(void) noexcept;
+        void beginEdge(void) noexcept;
+        void endEdge(void) noexcept;
+        void clear(void) noexcept;
+        void finish(void) noexcept;
+        bool parseGraphML(const std::string_view& filename) noexcept;
+        bool parseGml(const std::string_view& filename) noexcept;
+
+    public:
+        /**
+         * @brief Import topology file.
+         *
+         * Nodes, edges & channels of project are replaced by imported ones,
+         * load matrix is cleared.
+         *
+         * @param [out] context - given project context.
+         * @param [in] filename - given topology file name.
+         * @return true if topology was imported successfully, false otherwise.
+         */
+        bool parse(ProjectContext& context, const std::string_view& filename) noexcept;
+
+        /**
+         * @brief Check whether node names were changed by the last import.
+         *
+         * Project file separates node fields by commas & nodes by lines,
+         * so commas of imported names are replaced by semicolons & line
+         * breaks by spaces.
+         *
+         * @return true if some node name was changed, false otherwise.
+         */
+        bool isRenamed(void) const noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_TOPOLOGY_PARSER_HPP
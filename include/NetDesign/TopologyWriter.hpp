@@ -0,0 +1,55 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_DESIGN_TOPOLOGY_WRITER_HPP
+#define NET_DESIGN_TOPOLOGY_WRITER_HPP
+
+#include <NetDesign/TopologyParser.hpp>
+#include <string_view>
+#include <string>
+
+
+namespace netd {
+
+/**
+ * @brief Streaming exporter of GraphML & GML topologies.
+ *
+ * Exported files keep node names & positions, edges keep capacity
+ * & price of their channels, so they can be imported back.
+ */
+class TopologyWriter {
+    std::string m_buffer;
+
+    private:
+        bool saveGraphML(const ProjectContext& context, const std::string_view& filename) noexcept;
+        bool saveGml(const ProjectContext& context, const std::string_view& filename) noexcept;
+
+    public:
+        /**
+         * @brief Export project topology.
+         *
+         * @param [in] context - given project context.
+         * @param [in] filename - given topology file name.
+         * @return true if topology was exported successfully, false otherwise.
+         */
+        bool save(const ProjectContext& context, const std::string_view& filename) noexcept;
+};
+
+} // namespace netd
+
+#endif // NET_DESIGN_TOPOLOGY_WRITER_HPP
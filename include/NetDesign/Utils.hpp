@@ -19,6 +19,7 @@
 #ifndef NET_DESIGN_UTILS_HPP
 #define NET_DESIGN_UTILS_HPP
 
+#include <NetDesign/ProjectContext.hpp>
 #include <QtWidgets/QTableWidget>
 
 
@@ -29,7 +30,9 @@ void IGNORE_UNUSED(Args&&...) {}
 
 QString getItem(const QTableWidget *table, std::size_t row, std::size_t column) noexcept;
 
-void printProjectContext(void) noexcept;
+QString toQString(const std::string_view& str) noexcept;
+
+void printProjectContext(const ProjectContext& context) noexcept;
 
 void isExistRename(QString& filename, const std::string_view& suffix) noexcept;
 
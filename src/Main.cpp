@@ -25,9 +25,10 @@ std::int32_t main(std::int32_t argc, char **argv)
 {
     QApplication app(argc, argv);
 
-    auto window      = new netd::MainWindow();
-    netd::mainWindow = window;
-    window->show();
+    // window owns opened projects, so their journals are closed on exit
+    netd::MainWindow window;
+    netd::mainWindow = &window;
+    window.show();
 
     return app.exec();
 }
\ No newline at end of file
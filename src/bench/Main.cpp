@@ -0,0 +1,263 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @brief Shortest path microbenchmark.
+ *
+ * Compares Boost Dijkstra (adjacency list & d-ary heap) with radix heap
+ * Dijkstra & delta-stepping of NetworkGraph on synthetic topologies.
+ */
+
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <NetDesign/Core.hpp>
+#include <string_view>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <print>
+#include <cmath>
+
+
+namespace netd {
+
+constexpr std::int32_t EXIT_USAGE_ERROR {1};
+constexpr std::int32_t EXIT_MISMATCH    {2};
+
+using BoostGraph = boost::adjacency_list<
+    boost::vecS,
+    boost::vecS,
+    boost::undirectedS,
+    boost::no_property,
+    boost::property<boost::edge_weight_t, std::uint32_t>
+>;
+
+struct Options {
+    std::string_view m_topology {"random"};
+    std::size_t      m_nodeCount {100000};
+    std::size_t      m_degree {4};
+    std::uint32_t    m_maxWeight {1000};
+    std::size_t      m_sourceCount {10};
+    std::size_t      m_threadCount {std::thread::hardware_concurrency()};
+};
+
+static void printUsage(void) noexcept
+{
+    std::println(stderr, "Usage: NetDesign-bench [options]");
+    std::println(stderr, "");
+    std::println(stderr, "Options:");
+    std::println(stderr, "  --topology <random|grid>  synthetic topology (default: random)");
+    std::println(stderr, "  --nodes <count>           number of nodes (default: 100000)");
+    std::println(stderr, "  --degree <count>          average node degree of random topology (default: 4)");
+    std::println(stderr, "  --max-weight <weight>     maximum channel price (default: 1000)");
+    std::println(stderr, "  --sources <count>         number of searched source nodes (default: 10)");
+    std::println(stderr, "  -j, --jobs <count>        number of delta-stepping threads (default: CPU count)");
+}
+
+template<typename T>
+static bool parseNumber(const std::string_view& str, T& value) noexcept
+{
+    auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+    return result.ec == std::errc() && result.ptr == str.data() + str.size();
+}
+
+static bool parseOptions(std::int32_t argc, char **argv, Options& options) noexcept
+{
+    for (std::int32_t i = 1; i < argc; i++) {
+        std::string_view arg {argv[i]};
+
+        if (i + 1 >= argc)
+            return false;
+
+        std::string_view value {argv[++i]};
+
+        if (arg == "--topology")
+            options.m_topology = value;
+        else if (arg == "--nodes" && parseNumber(value, options.m_nodeCount))
+            continue;
+        else if (arg == "--degree" && parseNumber(value, options.m_degree))
+            continue;
+        else if (arg == "--max-weight" && parseNumber(value, options.m_maxWeight))
+            continue;
+        else if (arg == "--sources" && parseNumber(value, options.m_sourceCount))
+            continue;
+        else if ((arg == "-j" || arg == "--jobs") && parseNumber(value, options.m_threadCount))
+            continue;
+        else
+            return false;
+    }
+
+    bool isTopology = options.m_topology == "random" || options.m_topology == "grid";
+    return isTopology && options.m_nodeCount > 1 && options.m_maxWeight > 0;
+}
+
+/**
+ * @brief Make project of synthetic topology.
+ *
+ * Each edge has its own channel with random price, random topology
+ * connects random node pairs, grid topology connects lattice neighbours.
+ */
+static void makeTopology(ProjectContext& context, const Options& options) noexcept
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<std::uint32_t> price(1, options.m_maxWeight);
+
+    NodeTable nodes;
+    EdgeTable edgeTable;
+    std::vector<Channel> channels;
+
+    auto nodeCount = options.m_nodeCount;
+    nodes.resize(nodeCount);
+
+    auto addEdge = [&](std::size_t src, std::size_t dest) {
+        auto channel = static_cast<std::uint32_t>(channels.size());
+
+        channels.push_back({1, price(random), channel + 1});
+        edgeTable.push_back({static_cast<std::uint32_t>(src), static_cast<std::uint32_t>(dest), channel});
+    };
+
+    if (options.m_topology == "grid") {
+        auto width = static_cast<std::size_t>(std::sqrt(static_cast<double>(nodeCount)));
+
+        for (std::size_t i = 0; i < nodeCount; i++) {
+            if ((i + 1) % width != 0 && i + 1 < nodeCount)
+                addEdge(i, i + 1);
+
+            if (i + width < nodeCount)
+                addEdge(i, i + width);
+        }
+    }
+    else {
+        std::uniform_int_distribution<std::size_t> node(0, nodeCount - 1);
+
+        for (std::size_t i = 0; i < nodeCount * options.m_degree / 2; i++)
+            addEdge(node(random), node(random));
+    }
+
+    context.m_nodes     = std::move(nodes);
+    context.m_edgeTable = std::move(edgeTable);
+    context.m_channels  = std::move(channels);
+}
+
+static BoostGraph makeBoostGraph(const ProjectContext& context) noexcept
+{
+    const auto& edgeTable = *context.m_edgeTable;
+    const auto& channels  = *context.m_channels;
+
+    BoostGraph graph(context.m_nodes->size());
+
+    for (std::size_t i = 0; i < edgeTable.size(); i++)
+        boost::add_edge(edgeTable.source(i), edgeTable.target(i), channels[edgeTable.channel(i)].m_price, graph);
+
+    return graph;
+}
+
+template<typename Function>
+static double measure(const Function& function) noexcept
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+static std::int32_t run(const Options& options) noexcept
+{
+    ProjectContext context;
+    makeTopology(context, options);
+
+    auto nodeCount = context.m_nodes->size();
+
+    BoostGraph boostGraph;
+    NetworkGraph graph;
+
+    auto boostBuildTime = measure([&]() { boostGraph = makeBoostGraph(context); });
+    auto buildTime      = measure([&]() { graph.set(context, options.m_threadCount); });
+
+    std::vector<Distance> boostDistances(nodeCount);
+    std::vector<Distance> distances(nodeCount);
+    PathWorkspace workspace;
+
+    double boostTime {0.0}, dijkstraTime {0.0}, deltaTime {0.0};
+    std::size_t mismatchCount {0};
+
+    // compare distances of all implementations
+    auto check = [&]() {
+        for (std::size_t node = 0; node < nodeCount; node++) {
+            auto distance = workspace.isReached(node) ? workspace.distance(node) : std::numeric_limits<Distance>::max();
+            mismatchCount += (distance != boostDistances[node]) ? 1 : 0;
+        }
+    };
+
+    std::mt19937 random(7);
+    std::uniform_int_distribution<std::uint32_t> node(0, static_cast<std::uint32_t>(nodeCount - 1));
+
+    for (std::size_t i = 0; i < options.m_sourceCount; i++) {
+        auto src = node(random);
+
+        boostTime += measure([&]() {
+            auto distanceMap = boost::make_iterator_property_map(boostDistances.begin(), boost::get(boost::vertex_index, boostGraph));
+            boost::dijkstra_shortest_paths(boostGraph, src, boost::distance_map(distanceMap)
+                .distance_inf(std::numeric_limits<Distance>::max()));
+        });
+
+        dijkstraTime += measure([&]() { graph.dijkstra(src, &Channel::m_price, workspace); });
+        check();
+
+        deltaTime += measure([&]() { graph.deltaStepping(src, &Channel::m_price, 0, options.m_threadCount, workspace); });
+        check();
+    }
+
+    auto sourceCount = static_cast<double>(std::max<std::size_t>(options.m_sourceCount, 1));
+
+    std::println("topology: {}, nodes: {}, edges: {}, max weight: {}, threads: {}",
+                 options.m_topology, nodeCount, graph.edgeCount(), options.m_maxWeight, options.m_threadCount);
+    std::println("{:<24} {:>12}", "graph build", "ms");
+    std::println("{:<24} {:>12.3f}", "boost adjacency list", boostBuildTime);
+    std::println("{:<24} {:>12.3f}", "csr", buildTime);
+    std::println("{:<24} {:>12}", "single source", "ms/source");
+    std::println("{:<24} {:>12.3f}", "boost dijkstra", boostTime / sourceCount);
+    std::println("{:<24} {:>12.3f}", "radix heap dijkstra", dijkstraTime / sourceCount);
+    std::println("{:<24} {:>12.3f}", "delta-stepping", deltaTime / sourceCount);
+
+    if (mismatchCount > 0) {
+        std::println(stderr, "Distance mismatches: {}", mismatchCount);
+        return EXIT_MISMATCH;
+    }
+
+    return 0;
+}
+
+} // namespace netd
+
+std::int32_t main(std::int32_t argc, char **argv)
+{
+    netd::Options options;
+
+    if (!netd::parseOptions(argc, argv, options)) {
+        netd::printUsage();
+        return netd::EXIT_USAGE_ERROR;
+    }
+
+    return netd::run(options);
+}
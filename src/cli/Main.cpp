@@ -0,0 +1,280 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/Core.hpp>
+#include <string_view>
+#include <charconv>
+#include <cstdio>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include <print>
+
+
+namespace netd {
+
+constexpr std::int32_t EXIT_USAGE_ERROR   {1};
+constexpr std::int32_t EXIT_PROJECT_ERROR {2};
+
+struct RouteQuery {
+    std::string m_src;
+    std::string m_dest;
+};
+
+struct Options {
+    std::vector<RouteQuery> m_routes;
+    Scenario                m_scenario;
+    std::string             m_filename;
+    std::string             m_batchPath;
+    std::string_view        m_weightName {"price"};
+    ChannelMemberPtr        m_weight {&Channel::m_price};
+    std::size_t             m_jobCount {std::thread::hardware_concurrency()};
+    bool                    m_isTotalDelay {false};
+};
+
+static void printUsage(void) noexcept
+{
+    std::println(stderr, "Usage: NetDesign-cli [options] <project>");
+    std::println(stderr, "       NetDesign-cli [options] --batch <directory|manifest>");
+    std::println(stderr, "");
+    std::println(stderr, "Options:");
+    std::println(stderr, "  -w, --weight <price|capacity>  channel field used as edge weight (default: price)");
+    std::println(stderr, "  -r, --route <src> <dest>       find route between nodes by name, may be repeated");
+    std::println(stderr, "  -t, --total-delay              calculate average delay of all routes");
+    std::println(stderr, "  -b, --batch <path>             evaluate all projects of directory or manifest");
+    std::println(stderr, "  -j, --jobs <count>             number of batch worker threads (default: CPU count)");
+    std::println(stderr, "  --packet-size <size>           override packet size");
+    std::println(stderr, "  --channels <file>              override channels with catalog (id,capacity,price lines)");
+    std::println(stderr, "  --load-scale <factor>          multiply node loads by factor");
+    std::println(stderr, "  -h, --help                     print this help");
+    std::println(stderr, "");
+    std::println(stderr, "Results are printed to stdout as JSON, batch results as CSV table.");
+}
+
+template<typename T>
+static bool parseNumber(const std::string_view& str, T& value) noexcept
+{
+    auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+    return result.ec == std::errc() && result.ptr == str.data() + str.size();
+}
+
+static bool parseOptions(std::int32_t argc, char **argv, Options& options) noexcept
+{
+    auto& scenario = options.m_scenario;
+
+    for (std::int32_t i = 1; i < argc; i++) {
+        std::string_view arg {argv[i]};
+        bool hasValue = i + 1 < argc;
+
+        if ((arg == "-b" || arg == "--batch") && hasValue)
+            options.m_batchPath = argv[++i];
+        else if ((arg == "-j" || arg == "--jobs") && hasValue) {
+            if (!parseNumber(argv[++i], options.m_jobCount) || options.m_jobCount == 0)
+                return false;
+        }
+        else if (arg == "--packet-size" && hasValue) {
+            if (!parseNumber(argv[++i], scenario.m_packetSize))
+                return false;
+        }
+        else if (arg == "--load-scale" && hasValue) {
+            if (!parseNumber(argv[++i], scenario.m_loadScale) || scenario.m_loadScale < 0.0)
+                return false;
+        }
+        else if (arg == "--channels" && hasValue) {
+            if (!BatchRunner::loadChannels(argv[++i], scenario.m_channels)) {
+                std::println(stderr, "Could not load channel catalog: {}", argv[i]);
+                return false;
+            }
+        }
+        else if ((arg == "-w" || arg == "--weight") && hasValue) {
+            options.m_weightName = argv[++i];
+
+            if (options.m_weightName == "price")
+                options.m_weight = &Channel::m_price;
+            else if (options.m_weightName == "capacity")
+                options.m_weight = &Channel::m_capacity;
+            else
+                return false;
+        }
+        else if ((arg == "-r" || arg == "--route") && i + 2 < argc) {
+            options.m_routes.push_back({argv[i + 1], argv[i + 2]});
+            i += 2;
+        }
+        else if (arg == "-t" || arg == "--total-delay")
+            options.m_isTotalDelay = true;
+        else if (arg.starts_with('-') || !options.m_filename.empty())
+            return false;
+        else
+            options.m_filename = arg;
+    }
+
+    // total delay is the default analysis
+    if (options.m_routes.empty())
+        options.m_isTotalDelay = true;
+
+    return options.m_filename.empty() != options.m_batchPath.empty();
+}
+
+static std::string toJson(const std::string_view& str) noexcept
+{
+    std::string json {"\""};
+
+    for (auto ch : str) {
+        if (ch == '"' || ch == '\\') {
+            json.push_back('\\');
+            json.push_back(ch);
+        }
+        else if (static_cast<unsigned char>(ch) < 0x20)
+            json.push_back(' ');
+        else
+            json.push_back(ch);
+    }
+
+    json.push_back('"');
+    return json;
+}
+
+static std::string_view toString(RouteStatus status) noexcept
+{
+    switch (status) {
+        case RouteStatus::Ok:           return "ok";
+        case RouteStatus::SamePosition: return "same_node";
+        case RouteStatus::Unreachable:  return "unreachable";
+        case RouteStatus::NoCapacity:   return "no_capacity";
+    }
+
+    return "unknown";
+}
+
+static void printRoute(const ProjectContext& context, NetworkAnalysis& analysis, const Options& options, const RouteQuery& query) noexcept
+{
+    auto src  = context.findNode(query.m_src);
+    auto dest = context.findNode(query.m_dest);
+
+    std::print("    {{\"source\": {}, \"destination\": {}, ", toJson(query.m_src), toJson(query.m_dest));
+
+    if (!src || !dest) {
+        std::print("\"status\": \"unknown_node\"}}");
+        return;
+    }
+
+    auto route = analysis.findRoute(*src, *dest, options.m_weight);
+    std::print("\"status\": \"{}\", \"path\": [", toString(route.m_status));
+
+    for (std::size_t i = 0; i < route.m_path.size(); i++)
+        std::print("{}{}", (i > 0) ? ", " : "", toJson(context.m_nodes->name(route.m_path[i])));
+
+    std::print("], \"price\": {}, \"delay_ms\": ", route.m_price);
+
+    // overloaded channel has infinite delay
+    if (route.m_delay == std::numeric_limits<std::uint32_t>::max())
+        std::print("null}}");
+    else
+        std::print("{}}}", route.m_delay);
+}
+
+static std::int32_t run(const Options& options) noexcept
+{
+    ProjectContext context;
+    ProjectParser  parser;
+
+    if (!parser.parse(context, options.m_filename)) {
+        std::println(stderr, "Could not open project file: {}", options.m_filename);
+        return EXIT_PROJECT_ERROR;
+    }
+
+    // load matrix itself is not needed, node loads come from index
+    context.require(Section::Nodes);
+    context.require(Section::EdgeTable);
+    context.require(Section::Channels);
+    context.require(Section::PacketSize);
+
+    applyScenario(context, options.m_scenario);
+
+    // route endpoints are found by name
+    if (!options.m_routes.empty())
+        context.updateIndexes();
+
+    NetworkAnalysis analysis;
+    analysis.set(context, options.m_jobCount);
+
+    std::println("{{");
+    std::println("  \"project\": {},", toJson(options.m_filename));
+    std::println("  \"nodes\": {},", context.m_nodes->size());
+    std::println("  \"edges\": {},", context.m_edgeTable->size());
+    std::println("  \"weight\": \"{}\",", options.m_weightName);
+    std::print("  \"routes\": [");
+
+    for (std::size_t i = 0; i < options.m_routes.size(); i++) {
+        std::print("{}\n", (i > 0) ? "," : "");
+        printRoute(context, analysis, options, options.m_routes[i]);
+    }
+
+    std::print("{}]", options.m_routes.empty() ? "" : "\n  ");
+
+    if (options.m_isTotalDelay)
+        std::print(",\n  \"total_delay_ms\": {}", analysis.calculateTotalDelay(options.m_weight));
+
+    std::println("\n}}");
+
+    return 0;
+}
+
+static std::int32_t runBatch(const Options& options) noexcept
+{
+    auto projects = BatchRunner::getProjects(options.m_batchPath);
+
+    if (projects.empty()) {
+        std::println(stderr, "Could not find project files: {}", options.m_batchPath);
+        return EXIT_PROJECT_ERROR;
+    }
+
+    bool isOk {true};
+
+    // rows are printed as soon as projects are evaluated
+    std::println("project,status,nodes,edges,total_price,total_delay_ms,seconds");
+
+    BatchRunner::run(projects, options.m_scenario, options.m_weight, options.m_jobCount, [&isOk](const BatchResult& result) {
+        std::println("{},{},{},{},{},{},{:.3f}", toJson(result.m_filename), result.m_isOk ? "ok" : "error",
+                     result.m_nodeCount, result.m_edgeCount, result.m_totalPrice, result.m_totalDelay, result.m_elapsed);
+        std::fflush(stdout);
+
+        isOk = isOk && result.m_isOk;
+    });
+
+    return isOk ? 0 : EXIT_PROJECT_ERROR;
+}
+
+} // namespace netd
+
+std::int32_t main(std::int32_t argc, char **argv)
+{
+    netd::Options options;
+
+    if (!netd::parseOptions(argc, argv, options)) {
+        netd::printUsage();
+        return netd::EXIT_USAGE_ERROR;
+    }
+
+    if (!options.m_batchPath.empty())
+        return netd::runBatch(options);
+
+    return netd::run(options);
+}
@@ -0,0 +1,187 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/AnalysisWorker.hpp>
+#include <QtCore/QMetaObject>
+
+
+namespace netd {
+
+constexpr std::size_t ROUTE_COUNT {4}; // the chosen route & its alternatives
+
+static void getRoutes(const ProjectContext& context, NetworkAnalysis& analysis, ChannelMemberPtr weight,
+                      AnalysisResult& result, std::stop_token stopToken) noexcept
+{
+    auto routes = analysis.findRoutes(result.m_src, result.m_dest, weight, ROUTE_COUNT, stopToken);
+
+    result.m_route = std::move(routes[0]);
+    result.m_alternatives.assign(std::make_move_iterator(routes.begin() + 1), std::make_move_iterator(routes.end()));
+    result.m_edgeVersion = context.m_edgeTable.version();
+}
+
+AnalysisWorker::AnalysisWorker(QObject *receiver) noexcept : m_receiver(receiver)
+{
+    m_thread = std::jthread([this](std::stop_token stopToken) { loop(stopToken); });
+}
+
+AnalysisWorker::~AnalysisWorker(void) noexcept
+{
+    // running job is stopped, thread is stopped & joined as the last member
+    cancel();
+}
+
+void AnalysisWorker::post(std::uint64_t run, std::function<void(void)> function) noexcept
+{
+    QMetaObject::invokeMethod(m_receiver, [this, run, function = std::move(function)]() {
+        if (run == m_run)
+            function();
+    }, Qt::QueuedConnection);
+}
+
+void AnalysisWorker::schedule(std::shared_ptr<const ProjectContext> snapshot, Task task) noexcept
+{
+    {
+        std::lock_guard lock(m_mutex);
+
+        // job that hasn't started yet is replaced, so it is never run
+        m_stop.request_stop();
+        m_job = Job {std::move(snapshot), std::move(task)};
+    }
+
+    m_condition.notify_one();
+}
+
+void AnalysisWorker::loop(std::stop_token stopToken) noexcept
+{
+    // snapshot is kept with the graph built of it, analysis references it
+    std::shared_ptr<const ProjectContext> snapshot;
+    NetworkAnalysis analysis;
+
+    while (true) {
+        Job job;
+        std::stop_token jobToken;
+
+        {
+            std::unique_lock lock(m_mutex);
+
+            if (!m_condition.wait(lock, stopToken, [this]() { return m_job.has_value(); }))
+                return;
+
+            job = std::move(*m_job);
+            m_job.reset();
+            m_stop   = std::stop_source();
+            jobToken = m_stop.get_token();
+        }
+
+        // graph is rebuilt only when edges or channels of snapshot changed
+        analysis.update(*job.m_snapshot, std::thread::hardware_concurrency());
+        snapshot = std::move(job.m_snapshot);
+
+        if (!jobToken.stop_requested())
+            job.m_task(*snapshot, analysis, jobToken);
+    }
+}
+
+void AnalysisWorker::start(std::shared_ptr<const ProjectContext> snapshot, std::uint32_t src, std::uint32_t dest,
+                           ChannelMemberPtr weight, AnalysisProgress progress, AnalysisCallback callback) noexcept
+{
+    auto run    = ++m_run;
+    m_isRunning = true;
+
+    schedule(std::move(snapshot), [=, this](const ProjectContext& context, NetworkAnalysis& analysis,
+                                          std::stop_token stopToken) {
+        AnalysisResult result;
+        std::int32_t percent {-1};
+
+        result.m_src  = src;
+        result.m_dest = dest;
+
+        // each stage is skipped once analysis is canceled or restarted
+        getRoutes(context, analysis, weight, result, stopToken);
+
+        if (stopToken.stop_requested())
+            return;
+
+        NetworkAnalysis::calculateLinkUsage(context, result.m_linkUsage);
+
+        if (stopToken.stop_requested())
+            return;
+
+        // progress is queued only when it changes by percent
+        result.m_totalDelay = analysis.calculateTotalDelay(weight, stopToken, [&](std::size_t done, std::size_t total) {
+            auto current = static_cast<std::int32_t>(done * 100 / total);
+
+            if (current != percent) {
+                percent = current;
+                post(run, [progress, current]() { progress(current); });
+            }
+        });
+
+        if (stopToken.stop_requested())
+            return;
+
+        post(run, [this, callback, result = std::move(result)]() {
+            m_isRunning = false;
+            callback(result);
+        });
+    });
+}
+
+void AnalysisWorker::findRoutes(std::shared_ptr<const ProjectContext> snapshot, std::uint32_t src, std::uint32_t dest,
+                                ChannelMemberPtr weight, AnalysisCallback callback) noexcept
+{
+    auto run    = ++m_run;
+    m_isRunning = true;
+
+    schedule(std::move(snapshot), [=, this](const ProjectContext& context, NetworkAnalysis& analysis,
+                                          std::stop_token stopToken) {
+        AnalysisResult result;
+
+        result.m_src  = src;
+        result.m_dest = dest;
+
+        getRoutes(context, analysis, weight, result, stopToken);
+
+        if (stopToken.stop_requested())
+            return;
+
+        post(run, [this, callback, result = std::move(result)]() {
+            m_isRunning = false;
+            callback(result);
+        });
+    });
+}
+
+void AnalysisWorker::cancel(void) noexcept
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop.request_stop();
+        m_job.reset();
+    }
+
+    m_isRunning = false;
+    ++m_run;
+}
+
+bool AnalysisWorker::isRunning(void) const noexcept
+{
+    return m_isRunning;
+}
+
+} // namespace netd
@@ -0,0 +1,176 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/EdgeTableModel.hpp>
+#include <NetDesign/Utils.hpp>
+
+
+namespace netd {
+
+EdgeTableModel::EdgeTableModel(const Project& project, QObject *parent) noexcept
+    : QAbstractTableModel(parent), m_project(&project)
+{
+}
+
+void EdgeTableModel::reset(void) noexcept
+{
+    beginResetModel();
+    m_edges = m_project->m_context.m_edgeTable;
+    endResetModel();
+}
+
+void EdgeTableModel::insertEdge(void) noexcept
+{
+    auto row = static_cast<std::int32_t>(m_edges->size());
+
+    beginInsertRows(QModelIndex(), row, row);
+    m_edges.edit().push_back({0, 0, 0});
+    endInsertRows();
+}
+
+bool EdgeTableModel::removeEdge(std::int32_t row) noexcept
+{
+    if (row < 0 || static_cast<std::size_t>(row) >= m_edges->size())
+        return false;
+
+    beginRemoveRows(QModelIndex(), row, row);
+
+    // edge table has no erase, so later rows are shifted up
+    auto& edges = m_edges.edit();
+
+    for (auto i = static_cast<std::size_t>(row); i + 1 < edges.size(); i++)
+        edges.set(i, edges.edge(i + 1));
+
+    edges.resize(edges.size() - 1);
+    endRemoveRows();
+
+    return true;
+}
+
+const Shared<EdgeTable>& EdgeTableModel::edges(void) const noexcept
+{
+    return m_edges;
+}
+
+std::int32_t EdgeTableModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+
+    return static_cast<std::int32_t>(m_edges->size());
+}
+
+std::int32_t EdgeTableModel::columnCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+
+    return EDGE_COLUMN_COUNT;
+}
+
+QVariant EdgeTableModel::data(const QModelIndex& index, std::int32_t role) const
+{
+    const auto& edges = *m_edges;
+    auto row          = static_cast<std::size_t>(index.row());
+
+    if (!index.isValid() || row >= edges.size() || (role != Qt::DisplayRole && role != Qt::EditRole))
+        return {};
+
+    std::uint32_t position {0};
+
+    switch (index.column()) {
+        case EDGE_SOURCE_COLUMN:  position = edges.source(row);  break;
+        case EDGE_TARGET_COLUMN:  position = edges.target(row);  break;
+        case EDGE_CHANNEL_COLUMN: position = edges.channel(row); break;
+        default:                  return {};
+    }
+
+    if (role == Qt::EditRole)
+        return position;
+
+    const auto& context = m_project->m_context;
+
+    if (index.column() == EDGE_CHANNEL_COLUMN) {
+        if (position < context.m_channels->size())
+            return (*context.m_channels)[position].m_capacity;
+    }
+    else if (position < context.m_nodes->size())
+        return toQString(context.m_nodes->name(position));
+
+    return {};
+}
+
+QVariant EdgeTableModel::headerData(std::int32_t section, Qt::Orientation orientation, std::int32_t role) const
+{
+    if (role != Qt::DisplayRole)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    if (orientation == Qt::Vertical)
+        return section + 1;
+
+    switch (section) {
+        case EDGE_SOURCE_COLUMN:  return QString("Source Node");
+        case EDGE_TARGET_COLUMN:  return QString("Destination Node");
+        case EDGE_CHANNEL_COLUMN: return QString("Channel");
+        default:                  return {};
+    }
+}
+
+bool EdgeTableModel::setData(const QModelIndex& index, const QVariant& value, std::int32_t role)
+{
+    auto row = static_cast<std::size_t>(index.row());
+
+    if (!index.isValid() || row >= m_edges->size() || role != Qt::EditRole)
+        return false;
+
+    bool ok;
+    auto position       = value.toUInt(&ok);
+    const auto& context = m_project->m_context;
+
+    if (!ok)
+        return false;
+
+    auto edge = m_edges->edge(row);
+
+    switch (index.column()) {
+        case EDGE_SOURCE_COLUMN:  edge.m_source  = position; break;
+        case EDGE_TARGET_COLUMN:  edge.m_target  = position; break;
+        case EDGE_CHANNEL_COLUMN: edge.m_channel = position; break;
+        default:                  return false;
+    }
+
+    auto limit = (index.column() == EDGE_CHANNEL_COLUMN) ? context.m_channels->size() : context.m_nodes->size();
+
+    if (position >= limit)
+        return false;
+
+    m_edges.edit().set(row, edge);
+
+    emit dataChanged(index, index, {Qt::DisplayRole, Qt::EditRole});
+    return true;
+}
+
+Qt::ItemFlags EdgeTableModel::flags(const QModelIndex& index) const
+{
+    if (!index.isValid())
+        return Qt::NoItemFlags;
+
+    return Qt::ItemIsSelectable | Qt::ItemIsEditable | Qt::ItemIsEnabled;
+}
+
+} // namespace netd
@@ -17,7 +17,7 @@
  */
 
 #include <NetDesign/GraphController.hpp>
-#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/Project.hpp>
 #include <QtWidgets/QInputDialog>
 #include <QtWidgets/QMessageBox>
 #include <NetDesign/Utils.hpp>
@@ -26,61 +26,38 @@
 
 namespace netd {
 
-static auto& context = ProjectContext::instance();
-
-static std::uint32_t findNodeID(const std::string_view& name) noexcept
-{
-    auto it = std::find_if(context.m_nodes.begin(), context.m_nodes.end(),
-        [&name](const Node& node) {
-            return node.m_name.compare(name.data()) == 0;
-        });
-
-    if (it != context.m_nodes.end())
-        return it.base()->m_id;
-    else
-        QMessageBox::warning(nullptr, "Error", "Could not find node");
-
-    return 1;
-}
-
-static std::uint32_t findChannelID(const std::uint32_t capacity) noexcept
-{
-    auto it = std::find_if(context.m_channels.begin(), context.m_channels.end(),
-        [&capacity](const Channel& channel) {
-            return channel.m_capacity == capacity;
-        });
-
-    if (it != context.m_channels.end())
-        return it.base()->m_id;
-    else
-        QMessageBox::warning(nullptr, "Error", "Could not find channel");
-
-    return 1;
-}
-
-std::uint32_t GraphController::calculateDelay(double capacity, double load) noexcept
-{
-    if ((load / capacity) >= 1.0)
-        return std::numeric_limits<std::uint32_t>::max();
-
-    // M/D/1
-    double leftPart  = 1 / (2 * capacity);
-    double rightPart = load / (capacity * (capacity - load));
-
-    return static_cast<std::uint32_t>((leftPart + rightPart) * 1000);
-}
-
-GraphController::GraphController(GraphView *graphView) noexcept
+GraphController::GraphController(Project& project, GraphView *graphView) noexcept
 {
-    m_graphView = graphView;
-    m_weight    = &Channel::m_price;
+    m_project      = &project;
+    m_graphView    = graphView;
+    m_weight       = &Channel::m_price;
+    m_nodeNames    = new NodeNameModel(project, this);
+    m_edgeModel    = new EdgeTableModel(project, this);
+    m_edgeDelegate = new EdgeTableDelegate(m_nodeNames, project.m_context, this);
+
+    // node selectors share one model of node names
+    m_graphView->m_srcNodeComboBox->setModel(m_nodeNames);
+    m_graphView->m_destNodeComboBox->setModel(m_nodeNames);
+    m_graphView->m_edgeTable->setModel(m_edgeModel);
+    m_graphView->m_edgeTable->setItemDelegate(m_edgeDelegate);
 
     connect(m_graphView->m_priceRadioButton, &QRadioButton::toggled, this, [this]() {
         this->m_weight = &Channel::m_price;
+        this->updateRoutes();
     });
 
     connect(m_graphView->m_capacityRadioButton, &QRadioButton::toggled, this, [this]() {
         this->m_weight = &Channel::m_capacity;
+        this->updateRoutes();
+    });
+
+    // route is highlighted as soon as endpoints change
+    connect(m_graphView->m_srcNodeComboBox, &QComboBox::currentIndexChanged, this, [this]() {
+        this->updateRoutes();
+    });
+
+    connect(m_graphView->m_destNodeComboBox, &QComboBox::currentIndexChanged, this, [this]() {
+        this->updateRoutes();
     });
 
     connect(m_graphView->m_findRouteButton, &QPushButton::clicked, [this]() {
@@ -88,17 +65,40 @@ GraphController::GraphController(GraphView *graphView) noexcept
 
     });
 
+    connect(m_graphView->m_cancelButton, &QPushButton::clicked, this, [this]() {
+        this->m_worker.cancel();
+        this->m_graphView->setAnalysisRunning(false);
+    });
+
     connect(m_graphView->m_updateButton, &QPushButton::clicked, [this]() {
         this->updateContent();
     });
 
+    connect(m_graphView->m_fitButton, &QPushButton::clicked, this, [this]() {
+        this->m_graphView->fitView();
+    });
+
+    connect(m_graphView->m_layoutButton, &QPushButton::clicked, this, [this]() {
+        if (this->m_layoutWorker.isRunning())
+            this->stopLayout();
+        else
+            this->startLayout();
+    });
+
+    connect(m_graphView->m_heatmapCheckBox, &QCheckBox::toggled, this, [this]() {
+        this->m_graphView->updateHeatmap();
+    });
+
+    connect(m_graphView->m_thresholdSpinBox, &QSpinBox::valueChanged, this, [this]() {
+        this->m_graphView->updateHeatmap();
+    });
+
     // handle edge table buttons
     connect(m_graphView->m_addButton, &QPushButton::clicked, this, [this]() {
-        this->insertEdgeTableRow(false);
+        this->m_edgeModel->insertEdge();
     });
 
     connect(m_graphView->m_removeButton, &QPushButton::clicked, this, [this]() {
-        auto table = this->m_graphView->m_edgeTable;
         bool ok;
 
         QString rowStr = QInputDialog::getText(nullptr, "Remove row", "Row:", QLineEdit::Normal, "", &ok);
@@ -106,84 +106,34 @@ GraphController::GraphController(GraphView *graphView) noexcept
         if (ok && !rowStr.isEmpty()) {
             std::int32_t row = rowStr.toInt() - 1;
 
-            if (row >= 0 && row < table->rowCount())
-                table->removeRow(row);
-            else
+            if (!this->m_edgeModel->removeEdge(row))
                 QMessageBox::warning(nullptr, "Error", "Incorrect row");
         }
     });
 
     connect(m_graphView->m_submitButton, &QPushButton::clicked, this, [this]() {
-        auto table = this->m_graphView->m_edgeTable;
-
-        context.m_edgeTable.resize(table->rowCount(), 3);
-
-        for (std::int32_t row = 0; row < table->rowCount(); ++row) {
-            auto srcComboBox     = qobject_cast<QComboBox*>(table->cellWidget(row, 0));
-            auto destComboBox    = qobject_cast<QComboBox*>(table->cellWidget(row, 1));
-            auto channelComboBox = qobject_cast<QComboBox*>(table->cellWidget(row, 2));
-
-            if (srcComboBox && destComboBox && channelComboBox) {
-                auto srcValue     = srcComboBox->currentText().toStdString();
-                auto destValue    = destComboBox->currentText().toStdString();
-                auto channelValue = channelComboBox->currentText().toUInt();
+        auto& context = this->m_project->m_context;
 
-                context.m_edgeTable(row, 0) = findNodeID(srcValue) - 1;
-                context.m_edgeTable(row, 1) = findNodeID(destValue) - 1;
-                context.m_edgeTable(row, 2) = findChannelID(channelValue) - 1;
-            }
-        }
+        // rows already refer to node & channel positions
+        this->m_project->checkpoint();
+        context.m_edgeTable = this->m_edgeModel->edges();
 
+        this->m_project->m_journal.appendEdgeTable(*context.m_edgeTable);
         QMessageBox::information(nullptr, "Success", "Successfully updated edges & vertices");
     });
 }
 
-void GraphController::insertEdgeTableRow(bool flag) noexcept
-{
-    const auto& context = ProjectContext::instance();
-    auto& table         = m_graphView->m_edgeTable;
-    auto row            = table->rowCount();
-    table->insertRow(row);
-
-    auto srcComboBox  = new QComboBox();
-    auto destComboBox = new QComboBox();
-
-    // add source & destination nodes
-    for (const auto& node : context.m_nodes) {
-        srcComboBox->addItem(QString::fromStdString(node.m_name));
-        destComboBox->addItem(QString::fromStdString(node.m_name));
-    }
-
-    table->setCellWidget(row, 0, srcComboBox);
-    table->setCellWidget(row, 1, destComboBox);
-
-    // add channels
-    auto channelComboBox = new QComboBox();
-
-    for (const auto& channel : context.m_channels)
-        channelComboBox->addItem(QString::number(channel.m_capacity));
-
-    table->setCellWidget(row, 2, channelComboBox);
-
-    if (flag) {
-        srcComboBox->setCurrentIndex(context.m_edgeTable(row, 0));
-        destComboBox->setCurrentIndex(context.m_edgeTable(row, 1));
-        channelComboBox->setCurrentIndex(context.m_edgeTable(row, 2));
-    }
-}
-
 void GraphController::updateEdgeTable(void) noexcept
 {
-    const auto& context = ProjectContext::instance();
-    auto& table = m_graphView->m_edgeTable;
+    auto& context = m_project->m_context;
 
-    // Clear the edge table
-    table->setRowCount(0);
+    context.require(Section::Nodes);
+    context.require(Section::EdgeTable);
+    context.require(Section::Channels);
 
-    // Fill the edge table with combo boxes
-    auto edgeRows = static_cast<std::int32_t>(context.m_edgeTable.size1());
-    for (std::int32_t row = 0; row < edgeRows; row++)
-        insertEdgeTableRow(true);
+    // edge table cells are read by model when they are shown
+    m_nodeNames->reset();
+    m_edgeModel->reset();
 
     auto& loadTable = m_graphView->m_loadTable;
 
@@ -191,18 +141,7 @@ void GraphController::updateEdgeTable(void) noexcept
     loadTable->setRowCount(0);
 
     // Fill the load table with combo boxes
-    auto nodeRows = static_cast<std::int32_t>(context.m_nodes.size());
-
-    // Initialize loads vector with the size of nodes
-    std::vector<std::uint32_t> loads(nodeRows, 0);
-
-    // Calculate loads for each node
-    for (std::size_t i = 0; i < static_cast<std::uint32_t>(nodeRows); i++) {
-        std::uint32_t load = 0;
-        for (std::size_t j = 0; j < context.m_loadMatrix.size2(); j++)
-            load += context.m_loadMatrix(i, j);
-        loads[i] = load;
-    }
+    auto nodeRows = static_cast<std::int32_t>(context.m_nodes->size());
 
     // Populate the load table
     for (std::int32_t row = 0; row < nodeRows; row++) {
@@ -210,54 +149,61 @@ void GraphController::updateEdgeTable(void) noexcept
         loadTable->insertRow(loadTableRow);
 
         // Set the node name and load in the load table
-        loadTable->setItem(loadTableRow, 0, new QTableWidgetItem(QString::fromStdString(context.m_nodes.at(row).m_name)));
-        loadTable->setItem(loadTableRow, 1, new QTableWidgetItem(QString::number(loads.at(row))));
+        loadTable->setItem(loadTableRow, 0, new QTableWidgetItem(toQString(context.m_nodes->name(row))));
+        loadTable->setItem(loadTableRow, 1, new QTableWidgetItem(QString::number(context.nodeLoad(row))));
     }
 }
 
 void GraphController::updateContent(void) noexcept
 {
+    const auto& context = m_project->m_context;
+
+    // network graph is built by analysis worker
     updateEdgeTable();
-    m_graph.m_adjList.clear();
-    m_graph.set();
-    m_graphView->clearGraph();
+    m_graphView->updateGraph(context);
+    updateRoutes();
+}
 
-    std::size_t src {0}, dest {0};
+void GraphController::calculateDelays(void) noexcept
+{
+    std::uint32_t srcPos {0}, destPos {0};
 
-    // draw edges
-    for (const auto& edge : boost::make_iterator_range(boost::edges(m_graph.m_adjList))) {
-        src  = boost::source(edge, m_graph.m_adjList);
-        dest = boost::target(edge, m_graph.m_adjList);
+    // check that comboboxes are set correctly
+    bool isSrcEmpty  = (m_graphView->m_srcNodeComboBox->count() == 0);
+    bool isDestEmpty = (m_graphView->m_destNodeComboBox->count() == 0);
 
-        const auto& channel = m_graph.m_adjList[edge];
-        m_graphView->drawEdge(m_graph.m_adjList[src], m_graph.m_adjList[dest], channel);
+    if (!isSrcEmpty && !isDestEmpty) {
+        srcPos  = static_cast<std::uint32_t>(m_graphView->m_srcNodeComboBox->currentIndex());
+        destPos = static_cast<std::uint32_t>(m_graphView->m_destNodeComboBox->currentIndex());
     }
 
-    // draw nodes
-    for (const auto& vertex : boost::make_iterator_range(boost::vertices(m_graph.m_adjList)))
-        m_graphView->drawNode(m_graph.m_adjList[vertex]);
+    if (!m_weight)
+        return;
 
-    // fill comboboxes
-    m_graphView->m_srcNodeComboBox->clear();
-    m_graphView->m_destNodeComboBox->clear();
+    // analysis reads snapshot, so project can be edited while it runs,
+    // node loads come from project index, so load matrix is not parsed
+    auto snapshot = m_project->m_context.snapshot({Section::Nodes, Section::EdgeTable,
+                                                   Section::Channels, Section::PacketSize});
+    m_graphView->setAnalysisRunning(true);
 
-    for (const auto& node : ProjectContext::instance().m_nodes) {
-        auto str = QString::fromStdString(node.m_name);
-        m_graphView->m_srcNodeComboBox->addItem(str);
-        m_graphView->m_destNodeComboBox->addItem(str);
-    }
+    m_worker.start(std::move(snapshot), srcPos, destPos, m_weight, [this](std::int32_t percent) {
+        this->m_graphView->m_progressBar->setValue(percent);
+    }, [this](const AnalysisResult& result) {
+        this->m_graphView->setAnalysisRunning(false);
+        this->showDelays(result);
+    });
 }
 
-void GraphController::calculateDelays(void) noexcept
+void GraphController::showDelays(const AnalysisResult& result) noexcept
 {
-    auto [routeDelay, totalPrice] = calculateRouteDelay();
+    auto [routeDelay, totalPrice] = showRoute(result);
 
     if (routeDelay == std::numeric_limits<std::uint32_t>::max())
         m_graphView->m_routeDelayLabel->setText("Route Delay: Infinite Delay");
     else
         m_graphView->m_routeDelayLabel->setText("Route Delay: " + QString::number(routeDelay) + " ms");
 
-    auto totalDelay = calculateTotalDelay();
+    auto totalDelay = result.m_totalDelay;
 
     m_graphView->m_priceLabel->setText("Price: " + QString::number(totalPrice));
     m_graphView->m_totalDelayLabel->setText("Total Delay: " + QString::number(totalDelay) + " ms");
@@ -266,173 +212,140 @@ void GraphController::calculateDelays(void) noexcept
     std::println("Route delay: {} ms", routeDelay);
     std::println("Total delay: {} ms", totalDelay);
 
+    // recolor heatmap by analyzed project
+    m_graphView->setLinkUsage(result.m_linkUsage, result.m_edgeVersion);
+    showRoutes(result);
 }
 
-std::tuple<std::uint32_t, std::uint32_t> GraphController::calculateRouteDelay(void) noexcept
+void GraphController::updateRoutes(void) noexcept
 {
-    std::uint32_t srcPos {0}, destPos {0}, routeDelay {0}, totalPrice {0};
+    auto src  = m_graphView->m_srcNodeComboBox->currentIndex();
+    auto dest = m_graphView->m_destNodeComboBox->currentIndex();
 
-    // check that comboboxes are set correctly
-    bool isSrcEmpty  = (m_graphView->m_srcNodeComboBox->count() == 0);
-    bool isDestEmpty = (m_graphView->m_destNodeComboBox->count() == 0);
-
-    if (!isSrcEmpty && !isDestEmpty) {
-        srcPos  = static_cast<std::uint32_t>(m_graphView->m_srcNodeComboBox->currentIndex());
-        destPos = static_cast<std::uint32_t>(m_graphView->m_destNodeComboBox->currentIndex());
+    if (src < 0 || dest < 0 || src == dest || !m_weight) {
+        m_routeWorker.cancel();
+        m_graphView->setRoutes({}, 0);
+        return;
     }
 
-    if (srcPos == destPos) {
-        QMessageBox::warning(nullptr, "Error", "Incorrect node positions", QMessageBox::Ok);
-        return {0, 0};
-    }
+    // search is restarted on each change, only the last result is delivered,
+    // it reads graph and delays only, so load matrix is not parsed for it
+    auto snapshot = m_project->m_context.snapshot({Section::Nodes, Section::EdgeTable,
+                                                   Section::Channels, Section::PacketSize});
 
-    if (m_weight) {
-        auto [distances, predecessors] = m_graph.dijkstra(srcPos, m_weight);
+    m_routeWorker.findRoutes(std::move(snapshot), static_cast<std::uint32_t>(src),
+                             static_cast<std::uint32_t>(dest), m_weight, [this](const AnalysisResult& result) {
+        this->showRoutes(result);
+    });
+}
 
-        // output the results
-        std::println("Distances from node {}:", srcPos);
+void GraphController::showRoutes(const AnalysisResult& result) noexcept
+{
+    auto src  = static_cast<std::uint32_t>(m_graphView->m_srcNodeComboBox->currentIndex());
+    auto dest = static_cast<std::uint32_t>(m_graphView->m_destNodeComboBox->currentIndex());
 
-        for (std::size_t i = 0; i < distances.size(); ++i)
-            std::println("To node {}: {}", i, distances[i]);
+    // routes of endpoints changed meanwhile are stale
+    if (result.m_src != src || result.m_dest != dest)
+        return;
 
-        if (distances[destPos] == std::numeric_limits<std::int32_t>::max()) {
-            m_graphView->m_routeDelayLabel->setText("Route Delay: 0 ms");
-            m_graphView->m_totalDelayLabel->setText("Total Delay: 0 ms");
+    std::vector<Route> routes;
 
-            QString msg = "Destination " + QString::number(destPos) +
-                          " is not reachable from source " + QString::number(srcPos);
-            QMessageBox::warning(nullptr, "Warning", msg, QMessageBox::Ok);
+    if (!result.m_route.m_path.empty()) {
+        routes.push_back(result.m_route);
+        routes.insert(routes.end(), result.m_alternatives.begin(), result.m_alternatives.end());
+    }
 
-            return {0, 0};
-        }
+    m_graphView->setRoutes(std::move(routes), result.m_edgeVersion);
+}
 
-        std::vector<std::size_t> path;
+void GraphController::startLayout(void) noexcept
+{
+    auto& context = m_project->m_context;
 
-        for (VertexDescriptor v = destPos; v != srcPos; v = predecessors[v]) {
-            path.push_back(v);
+    context.require(Section::Nodes);
+    context.require(Section::EdgeTable);
 
-            // get the edge descriptor between predecessors[v] and v
-            auto edgePair = boost::edge(predecessors[v], v, m_graph.m_adjList);
+    if (context.m_nodes->empty())
+        return;
 
-            if (edgePair.second) {
-                auto& channel = m_graph.m_adjList[edgePair.first];
-                totalPrice += channel.m_price;
-            }
-        }
+    m_graphView->setLayoutRunning(true);
 
-        path.push_back(srcPos);
+    // frames move drawn nodes only, project is edited once layout finishes
+    m_layoutWorker.start(context.snapshot({Section::Nodes, Section::EdgeTable}), [this](const LayoutFrame& frame) {
+        this->m_graphView->showLayout(frame.m_xs, frame.m_ys);
+    }, [this](const LayoutResult& result) {
+        this->finishLayout(result);
+    });
+}
 
-        // reversing the path to get it from src to dest
-        std::reverse(path.begin(), path.end());
+void GraphController::stopLayout(void) noexcept
+{
+    m_layoutWorker.cancel();
+    m_graphView->setLayoutRunning(false);
 
-        // output the path
-        std::println("Path from {} to {}: ", srcPos, destPos);
-        for (const auto& node : path)
-            std::print("{} ->", node + 1);
-        std::puts(" x");
+    // drawn nodes are restored to project ones
+    m_graphView->updateGraph(m_project->m_context);
+}
 
-        std::uint32_t load {0}, capacity {0};
+void GraphController::finishLayout(const LayoutResult& result) noexcept
+{
+    auto& context = m_project->m_context;
+    m_graphView->setLayoutRunning(false);
+
+    // nodes edited during layout are kept
+    if (context.m_nodes.version() != result.m_nodeVersion) {
+        m_graphView->updateGraph(context);
+        QMessageBox::warning(nullptr, "Warning", "Nodes were changed during layout", QMessageBox::Ok);
+        return;
+    }
 
-        for (std::size_t j = 0; j < context.m_loadMatrix.size2(); j++)
-            load += context.m_loadMatrix(destPos, j);
+    m_project->checkpoint();
+    context.m_nodes = result.m_nodes;
+    m_project->m_journal.appendNodes(*context.m_nodes);
 
-        std::size_t lastChannelNode1 {0}, lastChannelNode2 {0};
+    updateContent();
+    m_graphView->fitView();
+}
 
-        lastChannelNode1 = path.back();
-        lastChannelNode2 = path.at(path.size() - 2);
+std::tuple<std::uint32_t, std::uint32_t> GraphController::showRoute(const AnalysisResult& result) noexcept
+{
+    const auto& route = result.m_route;
+    auto srcPos       = result.m_src;
+    auto destPos      = result.m_dest;
 
-        const auto& edgeTable = context.m_edgeTable;
+    switch (route.m_status) {
+        case RouteStatus::SamePosition:
+            QMessageBox::warning(nullptr, "Error", "Incorrect node positions", QMessageBox::Ok);
+            return {0, 0};
 
-        for (std::size_t i = 0; i < edgeTable.size1(); i++) {
-            const auto& node1 = edgeTable(i, 0);
-            const auto& node2 = edgeTable(i, 1);
+        case RouteStatus::Unreachable: {
+            m_graphView->m_routeDelayLabel->setText("Route Delay: 0 ms");
+            m_graphView->m_totalDelayLabel->setText("Total Delay: 0 ms");
 
-            bool isCondition1 = lastChannelNode1 == node1 && lastChannelNode2 == node2;
-            bool isCondition2 = lastChannelNode2 == node1 && lastChannelNode1 == node2;
+            QString msg = "Destination " + QString::number(destPos) +
+                          " is not reachable from source " + QString::number(srcPos);
+            QMessageBox::warning(nullptr, "Warning", msg, QMessageBox::Ok);
 
-            if (isCondition1 || isCondition2) {
-                capacity = context.m_channels.at(edgeTable(i, 2)).m_capacity;
-                break;
-            }
+            return {0, 0};
         }
 
-        capacity /= context.m_packetSize;   // capacity (packets/sec)
-        load     /= context.m_packetSize;   // load (packets/sec)
-
-        std::println("Capacity: {} packets/sec", capacity);
-        std::println("Load:     {} packets/sec", load);
-
-        if (capacity == 0) {
+        case RouteStatus::NoCapacity:
             QMessageBox::warning(nullptr, "Error", "Incorrect capacity", QMessageBox::Ok);
             m_graphView->m_routeDelayLabel->setText("Route Delay: 0 ms");
             m_graphView->m_totalDelayLabel->setText("Total Delay: 0 ms");
-            return {};
-        }
-
-        routeDelay = calculateDelay(static_cast<double>(capacity), static_cast<double>(load));
-    }
-
-    return std::tie(routeDelay, totalPrice);
-}
+            return {0, 0};
 
-std::uint32_t GraphController::calculateTotalDelay(void) noexcept
-{
-    // Initialize total delay and count of reachable routes
-    std::uint32_t totalDelay {0}, routeCount {0};
-
-    auto nodeCount = static_cast<std::uint32_t>(boost::num_vertices(m_graph.m_adjList));
-
-    for (std::uint32_t src = 0; src < nodeCount; ++src) {
-        auto [distances, predecessors] = m_graph.dijkstra(src, m_weight);
-
-        for (std::size_t dest = 0; dest < nodeCount; ++dest) {
-            if (src != dest && distances[dest] != std::numeric_limits<std::int32_t>::max()) {
-                // reconstruct the path from src to dest
-                std::vector<std::size_t> path;
-                for (VertexDescriptor v = dest; v != src; v = predecessors[v])
-                    path.push_back(v);
-                path.push_back(src);
-                std::reverse(path.begin(), path.end());
-
-                // calculate load and capacity for the last edge in the path
-                std::uint32_t load {0}, capacity {0};
-                auto lastChannelNode1 = path.back();
-                auto lastChannelNode2 = path.at(path.size() - 2);
-
-                const auto& edgeTable = context.m_edgeTable;
-
-                for (std::size_t i = 0; i < edgeTable.size1(); i++) {
-                    const auto& node1 = edgeTable(i, 0);
-                    const auto& node2 = edgeTable(i, 1);
-
-                    if ((lastChannelNode1 == node1 && lastChannelNode2 == node2) ||
-                        (lastChannelNode2 == node1 && lastChannelNode1 == node2)) {
-                        capacity = context.m_channels.at(edgeTable(i, 2)).m_capacity;
-                        break;
-                    }
-                }
-
-                // calculate load for the destination node
-                for (std::size_t j = 0; j < context.m_loadMatrix.size2(); j++)
-                    load += context.m_loadMatrix(dest, j);
-
-                // convert capacity and load to packets/sec
-                capacity /= context.m_packetSize;
-                load     /= context.m_packetSize;
-
-                // calculate the route delay
-                if (capacity > 0) {
-                    totalDelay += calculateDelay(static_cast<double>(capacity), static_cast<double>(load));
-                    ++routeCount;
-                }
-            }
-        }
+        default:
+            break;
     }
 
-    auto averageDelay = (routeCount > 0) ? (totalDelay / routeCount) : 0;
-    std::println("Average Network Delay: {} ms", averageDelay);
+    // output the path
+    std::println("Path from {} to {}: ", srcPos, destPos);
+    for (const auto& node : route.m_path)
+        std::print("{} ->", node + 1);
+    std::puts(" x");
 
-    return static_cast<std::uint32_t>(averageDelay);
+    return {route.m_delay, route.m_price};
 }
 
 } // namespace netd
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/LayoutWorker.hpp>
+#include <QtCore/QMetaObject>
+#include <chrono>
+#include <atomic>
+
+
+namespace netd {
+
+constexpr std::size_t MAX_LAYOUT_ITERATIONS {1000};
+constexpr std::chrono::milliseconds LAYOUT_FRAME_INTERVAL {33};
+
+void LayoutWorker::post(std::uint64_t run, std::function<void(void)> function) noexcept
+{
+    QMetaObject::invokeMethod(m_receiver, [this, run, function = std::move(function)]() {
+        if (run == m_run)
+            function();
+    }, Qt::QueuedConnection);
+}
+
+void LayoutWorker::start(std::shared_ptr<const ProjectContext> snapshot, LayoutProgress progress, LayoutCallback callback) noexcept
+{
+    auto run    = ++m_run;
+    m_isRunning = true;
+
+    // flag belongs to run, frame of canceled run may be never shown
+    auto isFramePending = std::make_shared<std::atomic<bool>>(false);
+
+    // assigning thread stops & joins previous one
+    m_thread = std::jthread([=, this, snapshot = std::move(snapshot)](std::stop_token stopToken) {
+        GraphLayout layout;
+        LayoutResult result;
+        auto frameTime = std::chrono::steady_clock::now();
+
+        layout.set(*snapshot->m_nodes, *snapshot->m_edgeTable, std::thread::hardware_concurrency());
+
+        layout.run(MAX_LAYOUT_ITERATIONS, stopToken, [&](const GraphLayout& current, std::size_t) {
+            auto now = std::chrono::steady_clock::now();
+
+            if (now - frameTime < LAYOUT_FRAME_INTERVAL || isFramePending->exchange(true))
+                return;
+
+            LayoutFrame frame;
+            frameTime = now;
+            current.getPositions(frame.m_xs, frame.m_ys);
+
+            post(run, [progress, isFramePending, frame = std::move(frame)]() {
+                progress(frame);
+                isFramePending->store(false);
+            });
+        });
+
+        if (stopToken.stop_requested())
+            return;
+
+        result.m_nodes       = *snapshot->m_nodes;
+        result.m_nodeVersion = snapshot->m_nodes.version();
+        layout.apply(result.m_nodes);
+
+        post(run, [this, callback, result = std::move(result)]() {
+            m_isRunning = false;
+            callback(result);
+        });
+    });
+}
+
+void LayoutWorker::cancel(void) noexcept
+{
+    // thread is joined when the next layout starts or worker is destroyed
+    m_thread.request_stop();
+    m_isRunning = false;
+    ++m_run;
+}
+
+bool LayoutWorker::isRunning(void) const noexcept
+{
+    return m_isRunning;
+}
+
+} // namespace netd
@@ -0,0 +1,122 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/LoadMatrixModel.hpp>
+
+
+namespace netd {
+
+LoadMatrixModel::LoadMatrixModel(Project& project, QObject *parent) noexcept
+    : QAbstractTableModel(parent), m_project(&project)
+{
+}
+
+void LoadMatrixModel::reset(void) noexcept
+{
+    beginResetModel();
+    endResetModel();
+}
+
+std::int32_t LoadMatrixModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+
+    return static_cast<std::int32_t>(m_project->m_context.m_loadMatrix.size1());
+}
+
+std::int32_t LoadMatrixModel::columnCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+
+    return static_cast<std::int32_t>(m_project->m_context.m_loadMatrix.size2());
+}
+
+QVariant LoadMatrixModel::data(const QModelIndex& index, std::int32_t role) const
+{
+    if (!index.isValid() || (role != Qt::DisplayRole && role != Qt::EditRole))
+        return {};
+
+    const auto& matrix = m_project->m_context.m_loadMatrix;
+    auto row           = static_cast<std::size_t>(index.row());
+    auto column        = static_cast<std::size_t>(index.column());
+
+    if (row >= matrix.size1() || column >= matrix.size2())
+        return {};
+
+    return matrix(row, column);
+}
+
+QVariant LoadMatrixModel::headerData(std::int32_t section, Qt::Orientation orientation, std::int32_t role) const
+{
+    if (role != Qt::DisplayRole)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    // rows & columns are numbered from 1, as node ids are
+    return section + 1;
+}
+
+bool LoadMatrixModel::setData(const QModelIndex& index, const QVariant& value, std::int32_t role)
+{
+    if (!index.isValid() || role != Qt::EditRole)
+        return false;
+
+    bool ok;
+    auto load = value.toUInt(&ok);
+
+    if (!ok)
+        return false;
+
+    auto& context = m_project->m_context;
+    auto& matrix  = context.m_loadMatrix;
+    auto row      = static_cast<std::size_t>(index.row());
+    auto column   = static_cast<std::size_t>(index.column());
+
+    if (row >= matrix.size1() || column >= matrix.size2())
+        return false;
+
+    auto previous = matrix(row, column);
+
+    if (previous == load)
+        return true;
+
+    m_project->checkpoint();
+    matrix.set(row, column, load);
+
+    // node load is sum of its row
+    auto& nodeLoads = context.m_nodeLoads.edit();
+
+    if (row < nodeLoads.size())
+        nodeLoads[row] += load - previous;
+
+    m_project->m_journal.appendLoadCells(matrix.size1(), false, {{static_cast<std::uint32_t>(row), static_cast<std::uint32_t>(column), load}});
+
+    emit dataChanged(index, index, {Qt::DisplayRole, Qt::EditRole});
+    return true;
+}
+
+Qt::ItemFlags LoadMatrixModel::flags(const QModelIndex& index) const
+{
+    if (!index.isValid())
+        return Qt::NoItemFlags;
+
+    return Qt::ItemIsSelectable | Qt::ItemIsEditable | Qt::ItemIsEnabled;
+}
+
+} // namespace netd
@@ -28,7 +28,11 @@ MenuController::MenuController(MenuView *menuView, QWidget *parent) noexcept
     parent->connect(actions[0], &QAction::triggered, this, &MenuController::onProjectNew);
     parent->connect(actions[1], &QAction::triggered, this, &MenuController::onProjectOpen);
     parent->connect(actions[2], &QAction::triggered, this, &MenuController::onProjectSave);
-    parent->connect(actions[3], &QAction::triggered, this, &MenuController::onProjectExit);
+    parent->connect(actions[3], &QAction::triggered, this, &MenuController::onProjectImport);
+    parent->connect(actions[4], &QAction::triggered, this, &MenuController::onProjectExport);
+    parent->connect(actions[5], &QAction::triggered, this, &MenuController::onProjectExit);
+    parent->connect(actions[6], &QAction::triggered, this, &MenuController::onEditUndo);
+    parent->connect(actions[7], &QAction::triggered, this, &MenuController::onEditRedo);
 }
 
 void MenuController::onProjectNew(void) noexcept
@@ -46,9 +50,29 @@ void MenuController::onProjectSave(void) noexcept
     m_projectController.saveProject();
 }
 
+void MenuController::onProjectImport(void) noexcept
+{
+    m_projectController.importTopology();
+}
+
+void MenuController::onProjectExport(void) noexcept
+{
+    m_projectController.exportTopology();
+}
+
 void MenuController::onProjectExit(void) noexcept
 {
     m_projectController.exitProject();
 }
 
+void MenuController::onEditUndo(void) noexcept
+{
+    m_projectController.undoEdit();
+}
+
+void MenuController::onEditRedo(void) noexcept
+{
+    m_projectController.redoEdit();
+}
+
 } // namespace netd
\ No newline at end of file
@@ -16,7 +16,6 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <NetDesign/ProjectContext.hpp>
 #include <NetDesign/NodeController.hpp>
 #include <QtWidgets/QMessageBox>
 #include <NetDesign/Utils.hpp>
@@ -24,9 +23,13 @@
 
 namespace netd {
 
-NodeController::NodeController(NodeView *nodeView) noexcept
+NodeController::NodeController(Project& project, NodeView *nodeView) noexcept
 {
-    m_nodeView = nodeView;
+    m_project   = &project;
+    m_nodeView  = nodeView;
+    m_loadModel = new LoadMatrixModel(project, this);
+
+    m_nodeView->m_matrixTable->setModel(m_loadModel);
 
     connect(m_nodeView->m_submitButton, &QPushButton::clicked, [this]() {
         this->saveNodeCount();
@@ -43,7 +46,12 @@ void NodeController::saveNodeCount(void) noexcept
     auto nodeCount = m_nodeView->m_lineEdit->text().toUInt(&ok);
 
     if (ok) {
-        ProjectContext::instance().m_nodes.resize(nodeCount);
+        auto& context = m_project->m_context;
+
+        m_project->checkpoint();
+        context.m_nodes.edit().resize(nodeCount);
+        m_project->m_journal.appendNodes(*context.m_nodes);
+        context.updateIndexes();
         this->setTables();
         QMessageBox::information(nullptr, "Success", "Successfully saved node count");
     }
@@ -53,13 +61,16 @@ void NodeController::saveNodeCount(void) noexcept
 
 void NodeController::saveTables(void) noexcept
 {
-    // save node table
-    auto& nodes = ProjectContext::instance().m_nodes;
-    nodes.clear();
+    auto& context = m_project->m_context;
+    m_project->checkpoint();
 
+    // save node table
     auto nodeTable = m_nodeView->m_nodeTable;
+    NodeTable nodes;
     Node node;
 
+    nodes.reserve(static_cast<std::size_t>(nodeTable->rowCount()));
+
     for (std::int32_t i = 0; i < nodeTable->rowCount(); i++) {
         node.m_id   = getItem(nodeTable, i, 0).toUInt();
         node.m_name = getItem(nodeTable, i, 1).toStdString();
@@ -69,22 +80,18 @@ void NodeController::saveTables(void) noexcept
         nodes.push_back(node);
     }
 
-    // save load matrix table
-    auto& matrix = ProjectContext::instance().m_loadMatrix;
-    matrix.clear();
-
-    for (std::size_t i = 0; i < matrix.size1(); i++) {
-        for (std::size_t j = 0; j < matrix.size2(); j++)
-            matrix(i, j) = getItem(m_nodeView->m_matrixTable, i, j).toUInt();
-    }
+    m_project->m_journal.appendNodes(nodes);
+    context.m_nodes = std::move(nodes);
+    context.updateIndexes();
 
+    // load matrix cells are journaled by model as soon as they are edited
     QMessageBox::information(nullptr, "Success", "Successfully saved node & matrix tables");
 }
 
 void NodeController::setTables(void) noexcept
 {
-    auto& nodes      = ProjectContext::instance().m_nodes;
-    auto nodeCount   = static_cast<std::int32_t>(nodes.size());
+    auto& context    = m_project->m_context;
+    auto nodeCount   = static_cast<std::int32_t>(context.m_nodes->size());
     auto nodeTable   = m_nodeView->m_nodeTable;
 
     // preventing unintentional table update
@@ -111,62 +118,42 @@ void NodeController::setTables(void) noexcept
     if (nodeCount == 0)
         return;
 
-    // clear all entries, but save headers
-    auto matrixTable = m_nodeView->m_matrixTable;
-    matrixTable->setRowCount(0);
-
-    auto& matrix = ProjectContext::instance().m_loadMatrix;
-    matrix.clear();
-    matrix.resize(nodeCount, nodeCount, false);
-
-    // set load matrix table
-    matrixTable->setRowCount(nodeCount);
-    matrixTable->setColumnCount(nodeCount);
+    auto& matrix = context.m_loadMatrix;
+    matrix.resize(static_cast<std::size_t>(nodeCount));
+    context.updateNodeLoads();
+    m_project->m_journal.appendLoadCells(matrix.size1(), true, {});
 
-    for (std::int32_t i = 0; i < nodeCount; i++) {
-        for (std::int32_t j = 0; j < nodeCount; j++)
-            matrixTable->setItem(i, j, new QTableWidgetItem("0"));
-    }
+    m_loadModel->reset();
 }
 
 void NodeController::updateContent(void) noexcept
 {
-    auto& nodes      = ProjectContext::instance().m_nodes;
-    auto nodeCount   = static_cast<std::int32_t>(nodes.size());
-    auto nodeTable   = m_nodeView->m_nodeTable;
+    m_project->m_context.require(Section::Nodes);
+    m_project->m_context.require(Section::LoadMatrix);
+
+    const auto& nodes = *m_project->m_context.m_nodes;
+    auto nodeCount    = static_cast<std::int32_t>(nodes.size());
+    auto nodeTable    = m_nodeView->m_nodeTable;
 
     // clear all entries, but save headers
     nodeTable->setRowCount(0);
 
     // update node table
     std::int32_t row {0};
-    Node *node {nullptr};
 
     for (std::int32_t i = 0; i < nodeCount; ++i) {
-        node = &nodes.at(i);
-        row  = nodeTable->rowCount();
+        row = nodeTable->rowCount();
         nodeTable->insertRow(row);
 
-        nodeTable->setItem(row, 0, new QTableWidgetItem(QString::number(node->m_id)));
-        nodeTable->setItem(row, 1, new QTableWidgetItem(QString::fromStdString(node->m_name)));
-        nodeTable->setItem(row, 2, new QTableWidgetItem(QString::number(node->m_x)));
-        nodeTable->setItem(row, 3, new QTableWidgetItem(QString::number(node->m_y)));
+        nodeTable->setItem(row, 0, new QTableWidgetItem(QString::number(nodes.id(i))));
+        nodeTable->setItem(row, 1, new QTableWidgetItem(toQString(nodes.name(i))));
+        nodeTable->setItem(row, 2, new QTableWidgetItem(QString::number(nodes.x(i))));
+        nodeTable->setItem(row, 3, new QTableWidgetItem(QString::number(nodes.y(i))));
     }
 
-    // clear all entries, but save headers
-    auto matrixTable = m_nodeView->m_matrixTable;
-    matrixTable->setRowCount(0);
-
-    auto& matrix = ProjectContext::instance().m_loadMatrix;
-
-    // update load matrix table
-    matrixTable->setRowCount(nodeCount);
-    matrixTable->setColumnCount(nodeCount);
-
-    for (std::int32_t i = 0; i < nodeCount; i++) {
-        for (std::int32_t j = 0; j < nodeCount; j++)
-            matrixTable->setItem(i, j, new QTableWidgetItem(QString::number(matrix(i, j))));
-    }
+    // load matrix cells are read by model when they are shown,
+    // imported topology has no loads yet
+    m_loadModel->reset();
 
     m_nodeView->m_lineEdit->setText(QString::number(nodes.size()));
 }
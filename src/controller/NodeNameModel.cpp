@@ -0,0 +1,55 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/NodeNameModel.hpp>
+#include <NetDesign/Utils.hpp>
+
+
+namespace netd {
+
+NodeNameModel::NodeNameModel(const Project& project, QObject *parent) noexcept
+    : QAbstractListModel(parent), m_project(&project)
+{
+}
+
+void NodeNameModel::reset(void) noexcept
+{
+    beginResetModel();
+    endResetModel();
+}
+
+std::int32_t NodeNameModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+
+    return static_cast<std::int32_t>(m_project->m_context.m_nodes->size());
+}
+
+QVariant NodeNameModel::data(const QModelIndex& index, std::int32_t role) const
+{
+    const auto& nodes = *m_project->m_context.m_nodes;
+    auto row          = static_cast<std::size_t>(index.row());
+
+    if (!index.isValid() || row >= nodes.size() || (role != Qt::DisplayRole && role != Qt::EditRole))
+        return {};
+
+    return toQString(nodes.name(row));
+}
+
+} // namespace netd
@@ -17,7 +17,6 @@
  */
 
 #include <NetDesign/ProjectController.hpp>
-#include <NetDesign/ProjectContext.hpp>
 #include <NetDesign/MainWindow.hpp>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QInputDialog>
@@ -31,114 +30,116 @@ namespace netd {
 static QString createFile(void) noexcept;
 static QString openFile(void) noexcept;
 
-static auto& projectContext = ProjectContext::instance();
-
-
 void ProjectController::createProject(void) noexcept
 {
     auto filename = createFile();
 
-    if (filename.isEmpty() || (projectContext.m_filename.compare(filename.toStdString()) == 0))
+    if (filename.isEmpty() || mainWindow->selectProject(filename.toStdString()))
         return;
 
-    projectContext.m_filename = std::move(filename.toStdString());
+    // empty project of current tab is reused, otherwise new tab is opened
+    auto& current = mainWindow->currentProject();
+    auto& project = current.isEmpty() ? current : mainWindow->addProject();
+
+    project.m_context.m_filename = filename.toStdString();
+    mainWindow->updateContent();
 }
 
 void ProjectController::openProject(void) noexcept
 {
     auto filename = openFile();
 
-    if (filename.isEmpty())
+    if (filename.isEmpty() || mainWindow->selectProject(filename.toStdString()))
         return;
 
-    projectContext.m_filename = std::move(filename.toStdString());
+    auto& current = mainWindow->currentProject();
+    auto& project = current.isEmpty() ? current : mainWindow->addProject();
+
+    if (!project.open(filename.toStdString()))
+        QMessageBox::warning(nullptr, "Error", "Could not open project file.");
 
-    m_parser.parse(projectContext.m_filename);
-    printProjectContext();
     mainWindow->updateContent();
 }
 
 void ProjectController::saveProject(void) noexcept
 {
-    const auto& context  = projectContext;
-    const auto& filename = context.m_filename;
+    auto& project = mainWindow->currentProject();
 
-    if (filename.empty())
-        createProject();
+    if (project.m_context.m_filename.empty()) {
+        auto filename = createFile();
 
-    std::ofstream fout(filename.data(), std::ios::out);
+        if (filename.isEmpty())
+            return;
 
-    if (!fout.is_open()) {
-        QMessageBox::warning(nullptr, "Error", "Could not create project file.");
-        return;
+        project.m_context.m_filename = filename.toStdString();
     }
 
-    // save nodes
-    fout << "# Nodes\n";
-    fout << "count," << context.m_nodes.size() << "\n";
-    fout << "id,name,x,y\n";
+    if (!project.save())
+        QMessageBox::warning(nullptr, "Error", "Could not save project file.");
 
-    for (const auto& node : context.m_nodes) {
-        fout << node.m_id << ",";
-        fout << node.m_name << ",";
-        fout << node.m_x << ",";
-        fout << node.m_y << "\n";
-    }
-    fout << "\n";
+    mainWindow->updateContent();
+}
 
-    // save load matrix
-    auto matrixCount = context.m_loadMatrix.size1();
+void ProjectController::importTopology(void) noexcept
+{
+    QString filename = QFileDialog::getOpenFileName(
+        nullptr,
+        "Import Topology",
+        "",
+        "Topology Files (*.graphml *.gml);;All Files (*)"
+    );
 
-    fout << "# Load Matrix\n";
-    fout << "count," << matrixCount << "\n";
+    if (filename.isEmpty())
+        return;
+
+    auto& project = mainWindow->currentProject();
+    auto& context = project.m_context;
 
-    for (std::size_t i = 0; i < matrixCount; i++) {
-        for (std::size_t j = 0; j < matrixCount; j++)
-            fout << context.m_loadMatrix(i, j) << ",";
-        fout << "\n";
+    project.checkpoint();
+
+    // failed import may have replaced sections partially, project returns to its version before it
+    if (!m_topologyParser.parse(context, filename.toStdString())) {
+        project.discard();
+        QMessageBox::warning(nullptr, "Error", "Could not import topology file.");
+        mainWindow->updateContent();
+        return;
     }
-    fout << "\n";
 
-    // save edge table
-    auto edgeCount = context.m_edgeTable.size1();
+    if (m_topologyParser.isRenamed())
+        QMessageBox::warning(nullptr, "Warning", "Commas and line breaks in node names were replaced.");
 
-    fout << "# Edge Table\n";
-    fout << "count," << edgeCount << "\n";
+    // imported sections replace project ones, so journal them as whole
+    bool isJournaled = project.m_journal.appendNodes(*context.m_nodes) &&
+                       project.m_journal.appendChannels(*context.m_channels) &&
+                       project.m_journal.appendEdgeTable(*context.m_edgeTable) &&
+                       project.m_journal.appendLoadCells(0, true, {});
 
-    for (std::size_t i = 0; i < edgeCount; i++) {
-        for (std::size_t j = 0; j < 3; j++)
-            fout << context.m_edgeTable(i, j) << ",";
-        fout << "\n";
-    }
-    fout << "\n";
-
-    // save routers
-    fout << "# Routers\n";
-    fout << "count," << context.m_routers.size() << "\n";
-    fout << "id,model,capacity,price\n";
-
-    for (const auto& router : context.m_routers) {
-        fout << router.m_id << ",";
-        fout << router.m_model << ",";
-        fout << router.m_capacity << ",";
-        fout << router.m_price << "\n";
-    }
-    fout << "\n";
+    if (!isJournaled)
+        QMessageBox::warning(nullptr, "Error", "Could not journal imported topology, save project to keep it.");
 
-    // save channels
-    fout << "# Channels\n";
-    fout << "count," << context.m_channels.size() << "\n";
-    fout << "id,capacity,price\n";
+    mainWindow->updateContent();
+}
 
-    for (const auto& channel : context.m_channels) {
-        fout << channel.m_id << ",";
-        fout << channel.m_capacity << ",";
-        fout << channel.m_price << "\n";
-    }
+void ProjectController::exportTopology(void) noexcept
+{
+    QString filename = QFileDialog::getSaveFileName(
+        nullptr,
+        "Export Topology",
+        "",
+        "GraphML Files (*.graphml);;GML Files (*.gml)"
+    );
+
+    if (filename.isEmpty())
+        return;
+
+    auto& context = mainWindow->currentProject().m_context;
 
-    fout << "\n# Packet Size\n";
-    fout << "size," << context.m_packetSize << "\n";
-    fout.close();
+    context.require(Section::Nodes);
+    context.require(Section::EdgeTable);
+    context.require(Section::Channels);
+
+    if (!m_topologyWriter.save(context, filename.toStdString()))
+        QMessageBox::warning(nullptr, "Error", "Could not export topology file.");
 }
 
 void ProjectController::exitProject(void) noexcept
@@ -156,6 +157,18 @@ void ProjectController::exitProject(void) noexcept
         QApplication::quit();
 }
 
+void ProjectController::undoEdit(void) noexcept
+{
+    if (mainWindow->currentProject().undo())
+        mainWindow->updateContent();
+}
+
+void ProjectController::redoEdit(void) noexcept
+{
+    if (mainWindow->currentProject().redo())
+        mainWindow->updateContent();
+}
+
 static QString createFile(void) noexcept
 {
     bool ok;
@@ -201,7 +214,7 @@ static QString openFile(void) noexcept
         nullptr,
         "Open File",
         "",
-        "NetDesign Project Files (*.ndproj);;All Files (*)"
+        "NetDesign Project Files (*.ndproj *.ndproj.gz *.ndproj.zst);;All Files (*)"
     );
 
     return filename;
@@ -17,15 +17,15 @@
  */
 
 #include <NetDesign/RouterController.hpp>
-#include <NetDesign/ProjectContext.hpp>
 #include <QtWidgets/QMessageBox>
 #include <NetDesign/Utils.hpp>
 
 
 namespace netd {
 
-RouterController::RouterController(RouterView *routerView) noexcept
+RouterController::RouterController(Project& project, RouterView *routerView) noexcept
 {
+    m_project    = &project;
     m_routerView = routerView;
 
     // handle packet size submit button click
@@ -43,7 +43,9 @@ void RouterController::savePacketSize(void) noexcept
     auto packetSize = this->m_routerView->m_lineEdit->text().toUInt(&ok);
 
     if (ok) {
-        ProjectContext::instance().m_packetSize = packetSize;
+        m_project->checkpoint();
+        m_project->m_context.m_packetSize = packetSize;
+        m_project->m_journal.appendPacketSize(packetSize);
         QMessageBox::information(nullptr, "Success", "Successfully saved packet size");
     }
     else
@@ -81,10 +83,8 @@ void RouterController::setRouterTable(void) noexcept
 
     // handle router table save button click
     connect(m_routerView->m_saveRouterButton, &QPushButton::clicked, [this]() {
-        auto& routers    = ProjectContext::instance().m_routers;
         auto routerTable = this->m_routerView->m_routerTable;
-        routers.clear();
-
+        std::vector<Router> routers;
         Router router;
 
         for (std::int32_t i = 0; i < routerTable->rowCount(); i++) {
@@ -96,6 +96,10 @@ void RouterController::setRouterTable(void) noexcept
             routers.push_back(router);
         }
 
+        m_project->checkpoint();
+        m_project->m_journal.appendRouters(routers);
+        m_project->m_context.m_routers = std::move(routers);
+
         QMessageBox::information(nullptr, "Success", "Successfully saved router table");
     });
 }
@@ -120,10 +124,8 @@ void RouterController::setChannelTable(void) noexcept
 
     // handle channel table save button click
     connect(m_routerView->m_saveChannelButton, &QPushButton::clicked, [this]() {
-        auto& channels    = ProjectContext::instance().m_channels;
         auto channelTable = this->m_routerView->m_channelTable;
-        channels.clear();
-
+        std::vector<Channel> channels;
         Channel channel;
 
         for (std::int32_t i = 0; i < channelTable->rowCount(); i++) {
@@ -134,15 +136,24 @@ void RouterController::setChannelTable(void) noexcept
             channels.push_back(channel);
         }
 
+        m_project->checkpoint();
+        m_project->m_journal.appendChannels(channels);
+        m_project->m_context.m_channels = std::move(channels);
+        m_project->m_context.updateIndexes();
+
         QMessageBox::information(nullptr, "Success", "Successfully saved channel table");
     });
 }
 
 void RouterController::updateContent(void) noexcept
 {
+    m_project->m_context.require(Section::Routers);
+    m_project->m_context.require(Section::Channels);
+    m_project->m_context.require(Section::PacketSize);
+
     // update router table
-    auto& routers     = ProjectContext::instance().m_routers;
-    auto& routerTable = this->m_routerView->m_routerTable;
+    const auto& routers = *m_project->m_context.m_routers;
+    auto& routerTable   = this->m_routerView->m_routerTable;
 
     routerTable->setRowCount(static_cast<std::int32_t>(routers.size()));
 
@@ -157,8 +168,8 @@ void RouterController::updateContent(void) noexcept
     }
 
     // update channel table
-    auto& channels     = ProjectContext::instance().m_channels;
-    auto& channelTable = this->m_routerView->m_channelTable;
+    const auto& channels = *m_project->m_context.m_channels;
+    auto& channelTable   = this->m_routerView->m_channelTable;
 
     channelTable->setRowCount(static_cast<std::int32_t>(channels.size()));
     i = 0;
@@ -170,7 +181,7 @@ void RouterController::updateContent(void) noexcept
         i++;
     }
 
-    auto packetSize = QString::number(ProjectContext::instance().m_packetSize);
+    auto packetSize = QString::number(m_project->m_context.m_packetSize);
     m_routerView->m_lineEdit->setText(packetSize);
 }
 
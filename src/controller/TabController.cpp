@@ -21,15 +21,30 @@
 
 namespace netd {
 
-TabController::TabController(TabView *tabView, QWidget *parent) noexcept
+constexpr std::int32_t SETTINGS_TAB {0};
+constexpr std::int32_t GRAPH_TAB    {1};
+
+TabController::TabController(Project& project, TabView *tabView, QWidget *parent) noexcept
 {
     m_tabView         = tabView;
-    m_settingsView    = new SettingsView(parent);
+    m_settingsView    = new SettingsView(project, parent);
     m_graphView       = new GraphView(parent);
-    m_graphController = new GraphController(m_graphView);
+    m_graphController = new GraphController(project, m_graphView);
 
     addTab(m_settingsView->m_tab, "Settings");
     addTab(m_graphView->m_tab, "Graph");
+
+    // update tab only when it is shown, so project sections are loaded on demand
+    QObject::connect(m_tabView->getTabWidget(), &QTabWidget::currentChanged, [this](std::int32_t index) {
+        this->updateTab(index);
+    });
+}
+
+TabController::~TabController(void) noexcept
+{
+    delete m_graphController;
+    delete m_settingsView;
+    delete m_graphView;
 }
 
 void TabController::addTab(QWidget *tab, const QString& title) noexcept
@@ -39,8 +54,26 @@ void TabController::addTab(QWidget *tab, const QString& title) noexcept
 
 void TabController::updateContent(void) noexcept
 {
-    m_settingsView->updateContent();
-    m_graphController->updateContent();
+    m_isOutdated.fill(true);
+    updateTab(m_tabView->getTabWidget()->currentIndex());
+}
+
+void TabController::updateTab(std::int32_t index) noexcept
+{
+    if (index != SETTINGS_TAB && index != GRAPH_TAB)
+        return;
+
+    auto& isOutdated = m_isOutdated[static_cast<std::size_t>(index)];
+
+    if (!isOutdated)
+        return;
+
+    isOutdated = false;
+
+    if (index == SETTINGS_TAB)
+        m_settingsView->updateContent();
+    else
+        m_graphController->updateContent();
 }
 
 } // namespace netd
\ No newline at end of file
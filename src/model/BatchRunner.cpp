@@ -0,0 +1,187 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/ProjectParser.hpp>
+#include <NetDesign/BatchRunner.hpp>
+#include <filesystem>
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <limits>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+
+namespace netd {
+
+static bool isProjectFile(const std::string_view& filename) noexcept
+{
+    return filename.ends_with(".ndproj") || filename.ends_with(".ndproj.gz") || filename.ends_with(".ndproj.zst");
+}
+
+void applyScenario(ProjectContext& context, const Scenario& scenario) noexcept
+{
+    if (!scenario.m_channels.empty())
+        context.m_channels = scenario.m_channels;
+
+    if (scenario.m_packetSize != 0)
+        context.m_packetSize = scenario.m_packetSize;
+
+    if (scenario.m_loadScale == 1.0)
+        return;
+
+    constexpr auto max = static_cast<double>(std::numeric_limits<std::uint32_t>::max());
+
+    // analysis uses node loads only, so load matrix is left as is
+    for (auto& load : context.m_nodeLoads.edit()) {
+        auto scaled = static_cast<double>(load) * scenario.m_loadScale;
+        load        = static_cast<std::uint32_t>(std::clamp(scaled, 0.0, max));
+    }
+}
+
+std::vector<std::string> BatchRunner::getProjects(const std::string_view& path) noexcept
+{
+    std::vector<std::string> projects;
+    std::error_code error;
+    std::filesystem::path root(path);
+
+    if (std::filesystem::is_directory(root, error)) {
+        for (const auto& entry : std::filesystem::directory_iterator(root, error)) {
+            auto filename = entry.path().string();
+
+            if (entry.is_regular_file(error) && isProjectFile(filename))
+                projects.push_back(std::move(filename));
+        }
+
+        std::sort(projects.begin(), projects.end());
+        return projects;
+    }
+
+    // manifest paths are relative to the manifest itself
+    std::ifstream fin(root);
+    std::string line;
+
+    while (std::getline(fin, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::filesystem::path project(line);
+
+        if (project.is_relative())
+            project = root.parent_path() / project;
+
+        projects.push_back(project.string());
+    }
+
+    return projects;
+}
+
+bool BatchRunner::loadChannels(const std::string_view& filename, std::vector<Channel>& channels) noexcept
+{
+    std::ifstream fin {std::string(filename)};
+
+    if (!fin.is_open())
+        return false;
+
+    std::string line;
+    channels.clear();
+
+    while (std::getline(fin, line)) {
+        const char *ptr = line.data();
+        const char *end = line.data() + line.size();
+
+        Channel channel;
+        std::uint32_t *fields[] {&channel.m_id, &channel.m_capacity, &channel.m_price};
+        bool isOk {true};
+
+        for (auto field : fields) {
+            auto result = std::from_chars(ptr, end, *field);
+
+            isOk = isOk && result.ec == std::errc();
+            ptr  = (result.ptr < end) ? result.ptr + 1 : end;
+        }
+
+        // skip header & empty lines
+        if (isOk)
+            channels.push_back(channel);
+    }
+
+    return !channels.empty();
+}
+
+BatchResult BatchRunner::evaluate(const std::string& filename, const Scenario& scenario, ChannelMemberPtr weight) noexcept
+{
+    auto start = std::chrono::steady_clock::now();
+
+    BatchResult    result;
+    ProjectContext context;
+    ProjectParser  parser;
+
+    result.m_filename = filename;
+
+    if (parser.parse(context, filename)) {
+        context.require(Section::Nodes);
+        context.require(Section::EdgeTable);
+        context.require(Section::Channels);
+        context.require(Section::PacketSize);
+
+        applyScenario(context, scenario);
+
+        NetworkAnalysis analysis;
+        analysis.set(context);
+
+        result.m_nodeCount  = context.m_nodes->size();
+        result.m_edgeCount  = context.m_edgeTable->size();
+        result.m_totalPrice = analysis.calculateTotalPrice();
+        result.m_totalDelay = analysis.calculateTotalDelay(weight);
+        result.m_isOk       = true;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    result.m_elapsed = elapsed.count();
+
+    return result;
+}
+
+void BatchRunner::run(const std::vector<std::string>& projects, const Scenario& scenario, ChannelMemberPtr weight,
+                      std::size_t threadCount, const BatchCallback& callback) noexcept
+{
+    std::atomic<std::size_t> next {0};
+    std::mutex mutex;
+
+    auto worker = [&]() {
+        for (auto i = next++; i < projects.size(); i = next++) {
+            auto result = evaluate(projects[i], scenario, weight);
+
+            std::lock_guard lock(mutex);
+            callback(result);
+        }
+    };
+
+    threadCount = std::clamp<std::size_t>(threadCount, 1, std::max<std::size_t>(projects.size(), 1));
+
+    std::vector<std::jthread> workers;
+    workers.reserve(threadCount);
+
+    for (std::size_t i = 0; i < threadCount; i++)
+        workers.emplace_back(worker);
+}
+
+} // namespace netd
@@ -0,0 +1,214 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/iostreams/filter/gzip.hpp>
+#include <NetDesign/Compression.hpp>
+
+#ifdef NETD_HAVE_ZSTD
+#include <boost/iostreams/filter/zstd.hpp>
+#endif
+
+
+namespace netd {
+
+constexpr std::size_t CHUNK_SIZE       {1024 * 1024};
+constexpr std::size_t MAX_READY_CHUNKS {4};
+
+Compression getCompression(const std::string_view& filename) noexcept
+{
+    if (filename.ends_with(".gz"))
+        return Compression::Gzip;
+
+#ifdef NETD_HAVE_ZSTD
+    if (filename.ends_with(".zst"))
+        return Compression::Zstd;
+#endif
+
+    return Compression::None;
+}
+
+void pushCompressor(boost::iostreams::filtering_ostream& stream, Compression compression) noexcept
+{
+    namespace io = boost::iostreams;
+
+    switch (compression) {
+        case Compression::Gzip:
+            // saving speed matters more, digits compress well anyway
+            stream.push(io::gzip_compressor(io::gzip_params(io::gzip::best_speed)));
+            break;
+
+#ifdef NETD_HAVE_ZSTD
+        case Compression::Zstd:
+            stream.push(io::zstd_compressor());
+            break;
+#endif
+
+        default:
+            break;
+    }
+}
+
+DecompressBuffer::~DecompressBuffer(void) noexcept
+{
+    close();
+}
+
+bool DecompressBuffer::open(const std::string_view& filename, Compression compression) noexcept
+{
+    close();
+
+    boost::iostreams::file_source source(std::string(filename), std::ios::in | std::ios::binary);
+
+    if (!source.is_open())
+        return false;
+
+    m_isStopped = false;
+    m_isFailed  = false;
+    m_isDone    = false;
+    m_thread    = std::thread(&DecompressBuffer::decompress, this, source, compression);
+
+    return true;
+}
+
+void DecompressBuffer::close(void) noexcept
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_isStopped = true;
+    }
+
+    m_condition.notify_all();
+
+    if (m_thread.joinable())
+        m_thread.join();
+
+    m_ready.clear();
+    m_current.clear();
+    setg(nullptr, nullptr, nullptr);
+}
+
+bool DecompressBuffer::isFailed(void) noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_isFailed;
+}
+
+bool DecompressBuffer::push(Chunk& chunk) noexcept
+{
+    std::unique_lock lock(m_mutex);
+
+    // wait until parser consumes some of decompressed data
+    m_condition.wait(lock, [this]() {
+        return m_isStopped || m_ready.size() < MAX_READY_CHUNKS;
+    });
+
+    if (m_isStopped)
+        return false;
+
+    m_ready.push_back(std::move(chunk));
+    m_condition.notify_all();
+
+    return true;
+}
+
+void DecompressBuffer::decompress(boost::iostreams::file_source source, Compression compression) noexcept
+{
+    namespace io = boost::iostreams;
+
+    bool isFailed {false};
+
+    try {
+        io::filtering_istream input;
+
+        switch (compression) {
+            case Compression::Gzip:
+                input.push(io::gzip_decompressor());
+                break;
+
+#ifdef NETD_HAVE_ZSTD
+            case Compression::Zstd:
+                input.push(io::zstd_decompressor());
+                break;
+#endif
+
+            default:
+                break;
+        }
+
+        input.push(source);
+
+        while (input) {
+            Chunk chunk;
+
+            // reuse chunks already consumed by parser
+            {
+                std::lock_guard lock(m_mutex);
+
+                if (!m_free.empty()) {
+                    chunk = std::move(m_free.back());
+                    m_free.pop_back();
+                }
+            }
+
+            chunk.resize(CHUNK_SIZE);
+            input.read(chunk.data(), static_cast<std::streamsize>(CHUNK_SIZE));
+            chunk.resize(static_cast<std::size_t>(input.gcount()));
+
+            if (!chunk.empty() && !push(chunk))
+                break;
+        }
+
+        isFailed = input.bad();
+    }
+    catch (...) {
+        isFailed = true;
+    }
+
+    std::lock_guard lock(m_mutex);
+    m_isFailed = isFailed;
+    m_isDone   = true;
+    m_condition.notify_all();
+}
+
+DecompressBuffer::int_type DecompressBuffer::underflow(void)
+{
+    std::unique_lock lock(m_mutex);
+
+    // give consumed chunk back to decompression thread
+    if (m_current.capacity() > 0)
+        m_free.push_back(std::move(m_current));
+
+    m_current = Chunk();
+
+    m_condition.wait(lock, [this]() {
+        return m_isStopped || m_isDone || !m_ready.empty();
+    });
+
+    if (m_ready.empty())
+        return traits_type::eof();
+
+    m_current = std::move(m_ready.front());
+    m_ready.pop_front();
+    m_condition.notify_all();
+
+    setg(m_current.data(), m_current.data(), m_current.data() + m_current.size());
+
+    return traits_type::to_int_type(*gptr());
+}
+
+} // namespace netd
@@ -0,0 +1,359 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/GraphLayout.hpp>
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <cmath>
+
+
+namespace netd {
+
+constexpr float NODE_SPACING         {150.0f}; // ideal edge length, scene units
+constexpr float THETA                {1.0f};   // Barnes-Hut opening angle
+constexpr float GRAVITY              {0.5f};   // pull to center, keeps components together
+constexpr float COOLING              {0.97f};  // temperature factor per iteration
+constexpr float MIN_TEMPERATURE      {NODE_SPACING * 0.01f};
+constexpr float MIN_DISTANCE         {0.01f};
+constexpr float GOLDEN_ANGLE         {2.39996323f};
+constexpr std::size_t MAX_TREE_DEPTH {32};
+constexpr std::size_t PARALLEL_MIN_NODES {1 << 11};
+
+void GraphLayout::set(const NodeTable& nodes, const EdgeTable& edgeTable, std::size_t threadCount) noexcept
+{
+    auto count = nodes.size();
+    std::size_t placedCount {0};
+
+    m_xs.assign(count, 0.0f);
+    m_ys.assign(count, 0.0f);
+    m_dxs.assign(count, 0.0f);
+    m_dys.assign(count, 0.0f);
+    m_isPinned.assign(count, 0);
+
+    m_centerX = 0.0f;
+    m_centerY = 0.0f;
+
+    for (std::size_t i = 0; i < count; i++) {
+        if (nodes.x(i) == 0 && nodes.y(i) == 0)
+            continue;
+
+        m_centerX += static_cast<float>(nodes.x(i));
+        m_centerY += static_cast<float>(nodes.y(i));
+        placedCount++;
+    }
+
+    // placed nodes are pinned only when some nodes need layout
+    m_hasPinned = placedCount > 0 && placedCount < count;
+
+    if (m_hasPinned) {
+        m_centerX /= static_cast<float>(placedCount);
+        m_centerY /= static_cast<float>(placedCount);
+    }
+    else {
+        m_centerX = 0.0f;
+        m_centerY = 0.0f;
+    }
+
+    // free nodes start on spiral around pinned ones
+    for (std::size_t i = 0, j = 0; i < count; i++) {
+        bool isPlaced = nodes.x(i) != 0 || nodes.y(i) != 0;
+
+        if (isPlaced && m_hasPinned) {
+            m_xs[i]       = static_cast<float>(nodes.x(i));
+            m_ys[i]       = static_cast<float>(nodes.y(i));
+            m_isPinned[i] = 1;
+            continue;
+        }
+
+        auto radius = NODE_SPACING * std::sqrt(static_cast<float>(j) + 0.5f);
+        auto angle  = GOLDEN_ANGLE * static_cast<float>(j++);
+
+        m_xs[i] = m_centerX + radius * std::cos(angle);
+        m_ys[i] = m_centerY + radius * std::sin(angle);
+    }
+
+    m_sources.clear();
+    m_targets.clear();
+
+    for (std::size_t i = 0; i < edgeTable.size(); i++) {
+        auto src  = edgeTable.source(i);
+        auto dest = edgeTable.target(i);
+
+        if (src < count && dest < count && src != dest) {
+            m_sources.push_back(src);
+            m_targets.push_back(dest);
+        }
+    }
+
+    // repulsion of n nodes on layout border is balanced by gravity
+    auto side     = NODE_SPACING * std::sqrt(static_cast<float>(count));
+    m_threadCount = std::max<std::size_t>(threadCount, 1);
+    m_temperature = std::max(NODE_SPACING, side * 0.1f);
+    m_gravity     = GRAVITY * side;
+}
+
+std::uint32_t GraphLayout::quadrant(std::uint32_t cell, float x, float y) const noexcept
+{
+    const auto& value = m_cells[cell];
+    auto half = value.m_size / 2;
+
+    return ((x >= value.m_minX + half) ? 1u : 0u) | ((y >= value.m_minY + half) ? 2u : 0u);
+}
+
+void GraphLayout::split(std::uint32_t cell) noexcept
+{
+    auto first  = static_cast<std::uint32_t>(m_cells.size());
+    auto parent = m_cells[cell];
+    auto half   = parent.m_size / 2;
+
+    for (std::uint32_t q = 0; q < 4; q++) {
+        Cell child;
+
+        child.m_minX = parent.m_minX + ((q & 1) ? half : 0.0f);
+        child.m_minY = parent.m_minY + ((q & 2) ? half : 0.0f);
+        child.m_size = half;
+        m_cells.push_back(child);
+    }
+
+    m_cells[cell].m_child = first;
+
+    // node of leaf moves to its quadrant
+    auto& moved  = m_cells[first + quadrant(cell, parent.m_x, parent.m_y)];
+    moved.m_x    = parent.m_x;
+    moved.m_y    = parent.m_y;
+    moved.m_mass = parent.m_mass;
+}
+
+void GraphLayout::insert(std::uint32_t node) noexcept
+{
+    auto x = m_xs[node];
+    auto y = m_ys[node];
+    std::uint32_t cell {0};
+
+    for (std::size_t depth = 0;; depth++) {
+        if (m_cells[cell].m_mass == 0.0f) {
+            m_cells[cell].m_x    = x;
+            m_cells[cell].m_y    = y;
+            m_cells[cell].m_mass = 1.0f;
+            return;
+        }
+
+        // nodes at the same point share leaf
+        bool isLeaf = m_cells[cell].m_child == 0;
+
+        if (isLeaf && depth < MAX_TREE_DEPTH)
+            split(cell);
+
+        auto& value = m_cells[cell];
+        auto mass   = value.m_mass + 1.0f;
+
+        value.m_x   += (x - value.m_x) / mass;
+        value.m_y   += (y - value.m_y) / mass;
+        value.m_mass = mass;
+
+        if (value.m_child == 0)
+            return;
+
+        cell = value.m_child + quadrant(cell, x, y);
+    }
+}
+
+void GraphLayout::buildTree(void) noexcept
+{
+    auto [minX, maxX] = std::ranges::minmax(m_xs);
+    auto [minY, maxY] = std::ranges::minmax(m_ys);
+
+    Cell root;
+    root.m_minX = minX;
+    root.m_minY = minY;
+    root.m_size = std::max(maxX - minX, maxY - minY) + 1.0f;
+
+    m_cells.clear();
+    m_cells.reserve(m_xs.size() * 2);
+    m_cells.push_back(root);
+
+    for (std::uint32_t i = 0; i < m_xs.size(); i++)
+        insert(i);
+}
+
+void GraphLayout::repulse(std::size_t first, std::size_t last) noexcept
+{
+    constexpr auto spacing2 = NODE_SPACING * NODE_SPACING;
+    constexpr auto theta2   = THETA * THETA;
+    std::vector<std::uint32_t> stack;
+
+    for (auto i = first; i < last; i++) {
+        float dx {0.0f}, dy {0.0f};
+        stack.assign(1, 0);
+
+        if (m_isPinned[i])
+            continue;
+
+        while (!stack.empty()) {
+            const auto& cell = m_cells[stack.back()];
+            stack.pop_back();
+
+            auto x  = m_xs[i] - cell.m_x;
+            auto y  = m_ys[i] - cell.m_y;
+            auto d2 = x * x + y * y;
+
+            // distant cell acts as single node of its total mass
+            if (cell.m_child == 0 || cell.m_size * cell.m_size < theta2 * d2) {
+                if (d2 > MIN_DISTANCE) {
+                    auto force = spacing2 * cell.m_mass / d2;
+                    dx        += x * force;
+                    dy        += y * force;
+                }
+
+                continue;
+            }
+
+            for (std::uint32_t q = 0; q < 4; q++) {
+                if (m_cells[cell.m_child + q].m_mass > 0.0f)
+                    stack.push_back(cell.m_child + q);
+            }
+        }
+
+        m_dxs[i] = dx;
+        m_dys[i] = dy;
+    }
+}
+
+void GraphLayout::attract(void) noexcept
+{
+    for (std::size_t i = 0; i < m_sources.size(); i++) {
+        auto src  = m_sources[i];
+        auto dest = m_targets[i];
+        auto x    = m_xs[src] - m_xs[dest];
+        auto y    = m_ys[src] - m_ys[dest];
+
+        // force d^2 / k along edge
+        auto force = std::sqrt(x * x + y * y) / NODE_SPACING;
+
+        m_dxs[src]  -= x * force;
+        m_dys[src]  -= y * force;
+        m_dxs[dest] += x * force;
+        m_dys[dest] += y * force;
+    }
+}
+
+void GraphLayout::move(void) noexcept
+{
+    for (std::size_t i = 0; i < m_xs.size(); i++) {
+        if (m_isPinned[i])
+            continue;
+
+        auto x = m_centerX - m_xs[i];
+        auto y = m_centerY - m_ys[i];
+        auto distance = std::sqrt(x * x + y * y);
+
+        if (distance > MIN_DISTANCE) {
+            m_dxs[i] += x / distance * m_gravity;
+            m_dys[i] += y / distance * m_gravity;
+        }
+
+        // displacement is limited by temperature
+        auto length = std::sqrt(m_dxs[i] * m_dxs[i] + m_dys[i] * m_dys[i]);
+
+        if (length > MIN_DISTANCE) {
+            auto scale = std::min(length, m_temperature) / length;
+            m_xs[i]   += m_dxs[i] * scale;
+            m_ys[i]   += m_dys[i] * scale;
+        }
+    }
+
+    m_temperature *= COOLING;
+}
+
+bool GraphLayout::step(void) noexcept
+{
+    auto count = m_xs.size();
+
+    if (count == 0 || m_temperature < MIN_TEMPERATURE)
+        return false;
+
+    buildTree();
+
+    // tree is read only, so nodes are split between threads without locks
+    auto threadCount = (count < PARALLEL_MIN_NODES) ? 1 : m_threadCount;
+    auto chunkSize   = (count + threadCount - 1) / threadCount;
+
+    {
+        std::vector<std::jthread> workers;
+
+        for (std::size_t t = 1; t < threadCount; t++) {
+            auto first = std::min(t * chunkSize, count);
+            workers.emplace_back([this, first, last = std::min(first + chunkSize, count)]() {
+                repulse(first, last);
+            });
+        }
+
+        repulse(0, std::min(chunkSize, count));
+    }
+
+    attract();
+    move();
+
+    return true;
+}
+
+void GraphLayout::run(std::size_t maxIterations, std::stop_token stopToken, const LayoutIteration& callback) noexcept
+{
+    for (std::size_t i = 0; i < maxIterations && !stopToken.stop_requested(); i++) {
+        if (!step())
+            break;
+
+        if (callback)
+            callback(*this, i + 1);
+    }
+}
+
+void GraphLayout::getPositions(std::vector<std::uint32_t>& xs, std::vector<std::uint32_t>& ys) const noexcept
+{
+    constexpr auto max = static_cast<float>(std::numeric_limits<std::uint32_t>::max());
+    float offsetX {0.0f}, offsetY {0.0f};
+
+    xs.resize(m_xs.size());
+    ys.resize(m_ys.size());
+
+    // layout without pinned nodes is moved next to origin
+    if (!m_hasPinned && !m_xs.empty()) {
+        offsetX = NODE_SPACING - std::ranges::min(m_xs);
+        offsetY = NODE_SPACING - std::ranges::min(m_ys);
+    }
+
+    for (std::size_t i = 0; i < m_xs.size(); i++) {
+        xs[i] = static_cast<std::uint32_t>(std::clamp(std::round(m_xs[i] + offsetX), 0.0f, max));
+        ys[i] = static_cast<std::uint32_t>(std::clamp(std::round(m_ys[i] + offsetY), 0.0f, max));
+    }
+}
+
+void GraphLayout::apply(NodeTable& nodes) const noexcept
+{
+    std::vector<std::uint32_t> xs, ys;
+    getPositions(xs, ys);
+
+    // pinned nodes keep their exact coordinates
+    for (std::size_t i = 0; i < std::min(nodes.size(), xs.size()); i++) {
+        if (!m_isPinned[i])
+            nodes.setPosition(i, xs[i], ys[i]);
+    }
+}
+
+} // namespace netd
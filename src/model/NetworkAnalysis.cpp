@@ -0,0 +1,278 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/NetworkAnalysis.hpp>
+#include <algorithm>
+#include <limits>
+
+
+namespace netd {
+
+constexpr std::size_t PARALLEL_MIN_EDGES {1 << 20};
+constexpr std::size_t MAX_ROUTE_ATTEMPTS {2}; // searches per route
+
+void NetworkAnalysis::set(const ProjectContext& context, std::size_t threadCount) noexcept
+{
+    m_context        = &context;
+    m_threadCount    = threadCount;
+    m_edgeVersion    = context.m_edgeTable.version();
+    m_channelVersion = context.m_channels.version();
+    m_graph.set(context, threadCount);
+}
+
+void NetworkAnalysis::update(const ProjectContext& context, std::size_t threadCount) noexcept
+{
+    bool isBuilt = m_context && m_edgeVersion == context.m_edgeTable.version() &&
+                   m_channelVersion == context.m_channels.version() &&
+                   m_graph.nodeCount() == context.m_nodes->size();
+
+    if (!isBuilt) {
+        set(context, threadCount);
+        return;
+    }
+
+    m_context     = &context;
+    m_threadCount = threadCount;
+}
+
+std::uint32_t NetworkAnalysis::calculateDelay(double capacity, double load) noexcept
+{
+    if ((load / capacity) >= 1.0)
+        return std::numeric_limits<std::uint32_t>::max();
+
+    // M/D/1
+    double leftPart  = 1 / (2 * capacity);
+    double rightPart = load / (capacity * (capacity - load));
+
+    return static_cast<std::uint32_t>((leftPart + rightPart) * 1000);
+}
+
+void NetworkAnalysis::calculateLinkUsage(const ProjectContext& context, LinkUsage& usage) noexcept
+{
+    const auto& edgeTable    = *context.m_edgeTable;
+    const auto& channels     = *context.m_channels;
+    const auto& sources      = edgeTable.sources();
+    const auto& targets      = edgeTable.targets();
+    const auto& edgeChannels = edgeTable.channels();
+
+    auto count      = edgeTable.size();
+    auto packetSize = context.m_packetSize;
+
+    std::vector<double> capacities(count), loads(count);
+    usage.m_utilizations.resize(count);
+    usage.m_delays.resize(count);
+
+    // gather capacities & loads (packets/sec) of edges, invalid edges stay empty
+    for (std::size_t i = 0; packetSize > 0 && i < count; i++) {
+        if (edgeChannels[i] >= channels.size())
+            continue;
+
+        auto load     = std::max(context.nodeLoad(sources[i]), context.nodeLoad(targets[i]));
+        capacities[i] = static_cast<double>(channels[edgeChannels[i]].m_capacity / packetSize);
+        loads[i]      = static_cast<double>(load / packetSize);
+    }
+
+    constexpr auto maxDelay = static_cast<double>(std::numeric_limits<std::uint32_t>::max());
+
+    // branchless M/D/1 of all edges at once, same as calculateDelay
+    for (std::size_t i = 0; i < count; i++) {
+        auto capacity     = capacities[i];
+        auto isValid      = capacity > 0.0;
+        auto isOverloaded = isValid && loads[i] >= capacity;
+        auto load         = isOverloaded ? 0.0 : loads[i];
+
+        // dummy capacity keeps selected out lanes finite
+        capacity = isValid ? capacity : 1.0;
+
+        auto delay = (1 / (2 * capacity) + load / (capacity * (capacity - load))) * 1000;
+        delay      = isOverloaded ? maxDelay : (isValid ? std::min(delay, maxDelay) : 0.0);
+
+        usage.m_utilizations[i] = isValid ? static_cast<float>(loads[i] / capacity) : 0.0f;
+        usage.m_delays[i]       = static_cast<std::uint32_t>(delay);
+    }
+}
+
+bool NetworkAnalysis::calculateRouteDelay(std::uint32_t lastArc, std::size_t dest, std::uint32_t& delay) const noexcept
+{
+    auto packetSize = m_context->m_packetSize;
+
+    if (packetSize == 0)
+        return false;
+
+    // convert capacity and load to packets/sec
+    auto capacity = m_graph.channel(lastArc).m_capacity / packetSize;
+    auto load     = m_context->nodeLoad(dest) / packetSize;
+
+    if (capacity == 0)
+        return false;
+
+    delay = calculateDelay(static_cast<double>(capacity), static_cast<double>(load));
+    return true;
+}
+
+Route NetworkAnalysis::findRoute(std::uint32_t src, std::uint32_t dest, ChannelMemberPtr weight) noexcept
+{
+    Route route;
+
+    if (src == dest) {
+        route.m_status = RouteStatus::SamePosition;
+        return route;
+    }
+
+    auto nodeCount = m_graph.nodeCount();
+
+    if (src >= nodeCount || dest >= nodeCount) {
+        route.m_status = RouteStatus::Unreachable;
+        return route;
+    }
+
+    // single search on huge graph is split between threads
+    if (m_threadCount > 1 && m_graph.edgeCount() >= PARALLEL_MIN_EDGES)
+        m_graph.deltaStepping(src, weight, 0, m_threadCount, m_workspace);
+    else
+        m_graph.dijkstra(src, weight, m_workspace);
+
+    if (!m_workspace.isReached(dest)) {
+        route.m_status = RouteStatus::Unreachable;
+        return route;
+    }
+
+    setRoute(route, m_workspace.path(dest));
+    return route;
+}
+
+void NetworkAnalysis::setRoute(Route& route, std::span<const std::uint32_t> path) const noexcept
+{
+    route.m_path.assign(path.begin(), path.end());
+    route.m_edges.clear();
+    route.m_status = RouteStatus::Ok;
+    route.m_price  = 0;
+
+    // arcs relaxed by the last search, which found the path, tell parallel edges apart
+    for (std::size_t i = 1; i < path.size(); i++) {
+        auto arc = m_workspace.predecessorArc(path[i]);
+
+        route.m_price += m_graph.channel(arc).m_price;
+        route.m_edges.push_back(m_graph.edge(arc));
+    }
+
+    auto dest = path.back();
+
+    if (path.size() < 2 || !calculateRouteDelay(m_workspace.predecessorArc(dest), dest, route.m_delay)) {
+        route.m_status = RouteStatus::NoCapacity;
+        route.m_price  = 0;
+    }
+}
+
+void NetworkAnalysis::penalize(std::size_t src, std::size_t dest) noexcept
+{
+    // both directions & parallel edges, as route may use either of them
+    for (auto arc = m_graph.arcBegin(src); arc < m_graph.arcEnd(src); arc++) {
+        if (m_graph.target(arc) == dest)
+            m_penalties[arc]++;
+    }
+
+    for (auto arc = m_graph.arcBegin(dest); arc < m_graph.arcEnd(dest); arc++) {
+        if (m_graph.target(arc) == src)
+            m_penalties[arc]++;
+    }
+}
+
+std::vector<Route> NetworkAnalysis::findRoutes(std::uint32_t src, std::uint32_t dest, ChannelMemberPtr weight,
+                                               std::size_t count, std::stop_token stopToken) noexcept
+{
+    std::vector<Route> routes;
+
+    if (count == 0)
+        return routes;
+
+    routes.push_back(findRoute(src, dest, weight));
+
+    if (routes[0].m_path.empty())
+        return routes;
+
+    std::vector<std::uint32_t> path(routes[0].m_path.begin(), routes[0].m_path.end());
+    m_penalties.assign(m_graph.arcCount(), 0);
+
+    auto maxAttempts = count * MAX_ROUTE_ATTEMPTS;
+
+    // edges of the last found route get heavier, so the next search detours
+    for (std::size_t attempt = 0; routes.size() < count && attempt < maxAttempts && !stopToken.stop_requested();
+         attempt++) {
+        for (std::size_t i = 1; i < path.size(); i++)
+            penalize(path[i - 1], path[i]);
+
+        m_graph.dijkstra(src, weight, m_penalties, m_workspace);
+
+        auto found = m_workspace.path(dest);
+        path.assign(found.begin(), found.end());
+
+        // route found again is penalized once more
+        bool isFound = std::ranges::any_of(routes, [&path](const Route& route) {
+            return std::ranges::equal(route.m_path, path);
+        });
+
+        if (!isFound)
+            setRoute(routes.emplace_back(), path);
+    }
+
+    return routes;
+}
+
+std::uint32_t NetworkAnalysis::calculateTotalDelay(ChannelMemberPtr weight, std::stop_token stopToken,
+                                                   const ProgressCallback& progress) noexcept
+{
+    std::uint32_t totalDelay {0}, routeCount {0}, delay {0};
+
+    auto nodeCount = static_cast<std::uint32_t>(m_graph.nodeCount());
+
+    // delay depends on the last channel of route only, so paths aren't built
+    for (std::uint32_t src = 0; src < nodeCount && !stopToken.stop_requested(); ++src) {
+        m_graph.dijkstra(src, weight, m_workspace);
+
+        for (std::size_t dest = 0; dest < nodeCount; ++dest) {
+            if (src == dest || !m_workspace.isReached(dest))
+                continue;
+
+            if (calculateRouteDelay(m_workspace.predecessorArc(dest), dest, delay)) {
+                totalDelay += delay;
+                ++routeCount;
+            }
+        }
+
+        if (progress)
+            progress(src + 1, nodeCount);
+    }
+
+    return (routeCount > 0) ? (totalDelay / routeCount) : 0;
+}
+
+std::uint64_t NetworkAnalysis::calculateTotalPrice(void) const noexcept
+{
+    std::uint64_t totalPrice {0};
+
+    for (std::size_t node = 0; node < m_graph.nodeCount(); node++) {
+        for (auto arc = m_graph.arcBegin(node); arc < m_graph.arcEnd(node); arc++)
+            totalPrice += m_graph.channel(arc).m_price;
+    }
+
+    // each edge is stored as two arcs
+    return totalPrice / 2;
+}
+
+} // namespace netd
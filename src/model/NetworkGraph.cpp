@@ -16,58 +16,333 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <boost/graph/dijkstra_shortest_paths.hpp>
-#include <NetDesign/ProjectContext.hpp>
 #include <NetDesign/NetworkGraph.hpp>
-#include <NetDesign/Utils.hpp>
-#include <print>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <thread>
 
 
 namespace netd {
 
-void NetworkGraph::set(void) noexcept
+constexpr std::size_t PARALLEL_MIN_EDGES    {1 << 16};
+constexpr std::size_t PARALLEL_MIN_FRONTIER {1 << 12};
+constexpr Distance MAX_BUCKET_COUNT         {1 << 12};
+
+void NetworkGraph::set(const ProjectContext& context, std::size_t threadCount) noexcept
+{
+    m_channels = context.m_channels;
+    build(*context.m_edgeTable, context.m_nodes->size(), m_channels->size(), threadCount);
+}
+
+void NetworkGraph::clear(void) noexcept
+{
+    m_offsets     = {};
+    m_targets     = {};
+    m_arcChannels = {};
+    m_arcEdges    = {};
+    m_channels    = {};
+}
+
+void NetworkGraph::build(const EdgeTable& edgeTable, std::size_t nodeCount, std::size_t channelCount,
+                         std::size_t threadCount) noexcept
+{
+    const auto& sources  = edgeTable.sources();
+    const auto& targets  = edgeTable.targets();
+    const auto& channels = edgeTable.channels();
+    auto edgeCount       = edgeTable.size();
+
+    if (threadCount == 0 || edgeCount < PARALLEL_MIN_EDGES)
+        threadCount = 1;
+
+    auto chunkSize = (edgeCount + threadCount - 1) / threadCount;
+
+    // arc counts of nodes in each chunk of edges, later turned into arc positions
+    std::vector<std::vector<std::uint32_t>> cursors(threadCount, std::vector<std::uint32_t>(nodeCount, 0));
+
+    auto forEachChunk = [&](const std::function<void(std::size_t, std::size_t, std::size_t)>& task) {
+        std::vector<std::jthread> workers;
+
+        for (std::size_t t = 1; t < threadCount; t++) {
+            auto first = std::min(t * chunkSize, edgeCount);
+            workers.emplace_back(task, t, first, std::min(first + chunkSize, edgeCount));
+        }
+
+        task(0, 0, std::min(chunkSize, edgeCount));
+    };
+
+    // skip edges referring to missing nodes or channels
+    auto isValid = [&](std::size_t edge) {
+        return sources[edge] < nodeCount && targets[edge] < nodeCount && channels[edge] < channelCount;
+    };
+
+    // count node degrees
+    forEachChunk([&](std::size_t chunk, std::size_t first, std::size_t last) {
+        auto& counts = cursors[chunk];
+
+        for (auto i = first; i < last; i++) {
+            if (isValid(i)) {
+                counts[sources[i]]++;
+                counts[targets[i]]++;
+            }
+        }
+    });
+
+    // prefix sums, arcs of node are ordered by chunk, so edge table order is kept
+    m_offsets.resize(nodeCount + 1);
+    std::uint32_t offset {0};
+
+    for (std::size_t node = 0; node < nodeCount; node++) {
+        m_offsets[node] = offset;
+
+        for (auto& counts : cursors) {
+            auto count   = counts[node];
+            counts[node] = offset;
+            offset      += count;
+        }
+    }
+
+    m_offsets[nodeCount] = offset;
+    m_targets.resize(offset);
+    m_arcChannels.resize(offset);
+    m_arcEdges.resize(offset);
+
+    // scatter edges as pairs of arcs
+    forEachChunk([&](std::size_t chunk, std::size_t first, std::size_t last) {
+        auto& cursor = cursors[chunk];
+
+        for (auto i = first; i < last; i++) {
+            if (!isValid(i))
+                continue;
+
+            auto src  = sources[i];
+            auto dest = targets[i];
+            auto arc  = cursor[src]++;
+
+            m_targets[arc]     = dest;
+            m_arcChannels[arc] = channels[i];
+            m_arcEdges[arc]    = static_cast<std::uint32_t>(i);
+
+            arc                = cursor[dest]++;
+            m_targets[arc]     = src;
+            m_arcChannels[arc] = channels[i];
+            m_arcEdges[arc]    = static_cast<std::uint32_t>(i);
+        }
+    });
+}
+
+template<typename WeightOf>
+void NetworkGraph::search(std::uint32_t src, const WeightOf& weightOf, PathWorkspace& workspace) const noexcept
+{
+    auto& queue = workspace.m_queue;
+
+    workspace.reset(nodeCount());
+    workspace.reach(src, 0, src, NO_ARC);
+    queue.push(0, src);
+
+    // outdated entries are skipped instead of decrease-key
+    while (!queue.empty()) {
+        auto [distance, node] = queue.pop();
+
+        // node was already reached by shorter path
+        if (distance > workspace.m_distances[node])
+            continue;
+
+        for (auto arc = arcBegin(node); arc < arcEnd(node); arc++) {
+            auto next      = m_targets[arc];
+            auto candidate = distance + weightOf(arc);
+
+            if (!workspace.isReached(next) || candidate < workspace.m_distances[next]) {
+                workspace.reach(next, candidate, node, arc);
+                queue.push(candidate, next);
+            }
+        }
+    }
+}
+
+void NetworkGraph::dijkstra(std::uint32_t src, ChannelMemberPtr weight, PathWorkspace& workspace) const noexcept
+{
+    search(src, [this, weight](std::uint32_t arc) {
+        return static_cast<Distance>(channel(arc).*weight);
+    }, workspace);
+}
+
+void NetworkGraph::dijkstra(std::uint32_t src, ChannelMemberPtr weight, const std::vector<std::uint32_t>& penalties,
+                            PathWorkspace& workspace) const noexcept
+{
+    search(src, [this, weight, &penalties](std::uint32_t arc) {
+        return static_cast<Distance>(channel(arc).*weight) * (static_cast<Distance>(penalties[arc]) + 1);
+    }, workspace);
+}
+
+template<typename Task>
+static void runTasks(std::size_t taskCount, bool isParallel, const Task& task) noexcept
 {
-    auto& projectContext = ProjectContext::instance();
-    auto& edgeTable      = projectContext.m_edgeTable;
-    auto& channels       = projectContext.m_channels;
-    auto& nodes          = projectContext.m_nodes;
-
-    // add nodes
-    for (const auto& node : nodes)
-        boost::add_vertex(node, m_adjList);
-
-    // add channels
-    for (std::size_t i = 0; i < edgeTable.size1(); i++) {
-        auto srcNodeID  = edgeTable(i, 0);
-        auto destNodeID = edgeTable(i, 1);
-        auto channelID  = edgeTable(i, 2);
-
-        boost::add_edge(srcNodeID, destNodeID, channels.at(channelID), m_adjList);
+    if (!isParallel) {
+        for (std::size_t i = 0; i < taskCount; i++)
+            task(i);
+
+        return;
     }
+
+    std::vector<std::jthread> workers;
+
+    for (std::size_t i = 1; i < taskCount; i++)
+        workers.emplace_back([&task, i]() { task(i); });
+
+    task(0);
+}
+
+// start new round of marks, marks are cleared only when round counter wraps
+static std::uint32_t nextRound(std::vector<std::uint32_t>& marks, std::uint32_t& round) noexcept
+{
+    if (++round == 0) {
+        std::fill(marks.begin(), marks.end(), 0);
+        round = 1;
+    }
+
+    return round;
+}
+
+std::size_t NetworkGraph::relaxArcs(const std::vector<std::uint32_t>& nodes, ChannelMemberPtr weight, Distance delta,
+                                    bool isLight, std::size_t threadCount, PathWorkspace& workspace) const noexcept
+{
+    auto& pushCounts = workspace.m_pushCounts;
+    auto& requests   = workspace.m_requests;
+    auto& buckets    = workspace.m_buckets;
+    auto slotCount   = buckets[0].size();
+    auto chunkSize   = (nodes.size() + threadCount - 1) / threadCount;
+    bool isParallel  = threadCount > 1 && nodes.size() >= PARALLEL_MIN_FRONTIER;
+
+    // requests are sorted by owner of target node, so that
+    // each node is relaxed by one thread without atomics
+    runTasks(threadCount, isParallel, [&](std::size_t chunk) {
+        auto first  = std::min(chunk * chunkSize, nodes.size());
+        auto last   = std::min(first + chunkSize, nodes.size());
+        auto outbox = requests.begin() + static_cast<std::ptrdiff_t>(chunk * threadCount);
+
+        for (auto i = first; i < last; i++) {
+            auto node     = nodes[i];
+            auto distance = workspace.m_distances[node];
+
+            for (auto arc = arcBegin(node); arc < arcEnd(node); arc++) {
+                Distance arcWeight = channel(arc).*weight;
+
+                if ((arcWeight <= delta) != isLight)
+                    continue;
+
+                auto next = m_targets[arc];
+                outbox[next % threadCount].push_back({distance + arcWeight, next, node, arc});
+            }
+        }
+    });
+
+    runTasks(threadCount, isParallel, [&](std::size_t owner) {
+        auto& ownBuckets  = buckets[owner];
+        pushCounts[owner] = 0;
+
+        for (std::size_t chunk = 0; chunk < threadCount; chunk++) {
+            auto& inbox = requests[chunk * threadCount + owner];
+
+            for (const auto& request : inbox) {
+                auto next = request.m_node;
+
+                if (workspace.isReached(next) && request.m_distance >= workspace.m_distances[next])
+                    continue;
+
+                workspace.reach(next, request.m_distance, request.m_predecessor, request.m_arc);
+                ownBuckets[(request.m_distance / delta) % slotCount].push_back(next);
+                pushCounts[owner]++;
+            }
+
+            inbox.clear();
+        }
+    });
+
+    return std::accumulate(pushCounts.begin(), pushCounts.end(), std::size_t {0});
 }
 
-std::tuple<Distances, VertexDescriptors> NetworkGraph::dijkstra(std::uint32_t src, ChannelMemberPtr weight) noexcept
+void NetworkGraph::deltaStepping(std::uint32_t src, ChannelMemberPtr weight, Distance delta,
+                                 std::size_t threadCount, PathWorkspace& workspace) const noexcept
 {
-    auto verticeCount = boost::num_vertices(m_adjList);
-    auto initValue    = std::numeric_limits<std::int32_t>::max();
+    auto count = nodeCount();
+    threadCount = std::max<std::size_t>(threadCount, 1);
+
+    Distance maxWeight {0};
 
-    Distances distances(verticeCount, initValue);
+    for (const auto& channel : *m_channels)
+        maxWeight = std::max<Distance>(maxWeight, channel.*weight);
 
-    // store predecessors for path reconstruction
-    VertexDescriptors predecessors(verticeCount);
-    distances[src] = 0;
+    // bucket width of about max weight / degree keeps few light relaxations per node
+    if (delta == 0 && !m_targets.empty())
+        delta = maxWeight * count / m_targets.size();
+
+    // pending distances span max weight, so ring of buckets is reused
+    delta          = std::max({delta, maxWeight / MAX_BUCKET_COUNT, Distance {1}});
+    auto slotCount = static_cast<std::size_t>(maxWeight / delta + 2);
+
+    workspace.reset(count);
+    workspace.m_frontierMarks.resize(count);
+    workspace.m_settledMarks.resize(count);
+    workspace.m_requests.resize(threadCount * threadCount);
+    workspace.m_pushCounts.resize(threadCount);
+    workspace.m_buckets.resize(threadCount);
+
+    for (auto& buckets : workspace.m_buckets) {
+        buckets.resize(slotCount);
+
+        for (auto& bucket : buckets)
+            bucket.clear();
+    }
 
-    // create the edge weight map using the price from the Channel structure
-    auto weightMap = get(weight, m_adjList);
+    auto& buckets  = workspace.m_buckets;
+    auto& frontier = workspace.m_frontier;
+    auto& settled  = workspace.m_settled;
 
-    // run Dijkstra's algorithm
-    auto property = boost::distance_map(&distances[0])
-                    .predecessor_map(&predecessors[0])
-                    .weight_map(weightMap);
+    // number of bucket entries, including outdated ones
+    std::size_t pendingCount {1};
 
-    boost::dijkstra_shortest_paths(m_adjList, src, property);
+    workspace.reach(src, 0, src, NO_ARC);
+    buckets[src % threadCount][0].push_back(src);
 
-    return std::tie(distances, predecessors);
+    for (Distance bucket = 0; pendingCount > 0; bucket++) {
+        auto slot        = static_cast<std::size_t>(bucket % slotCount);
+        auto settleRound = nextRound(workspace.m_settledMarks, workspace.m_settledRound);
+
+        settled.clear();
+
+        // relax light arcs, until no node moves into bucket
+        while (true) {
+            auto frontierRound = nextRound(workspace.m_frontierMarks, workspace.m_frontierRound);
+            frontier.clear();
+
+            for (auto& ownBuckets : buckets) {
+                for (auto node : ownBuckets[slot]) {
+                    // node moved to lower bucket or is already in frontier
+                    if (workspace.m_distances[node] / delta != bucket || workspace.m_frontierMarks[node] == frontierRound)
+                        continue;
+
+                    workspace.m_frontierMarks[node] = frontierRound;
+                    frontier.push_back(node);
+
+                    if (workspace.m_settledMarks[node] != settleRound) {
+                        workspace.m_settledMarks[node] = settleRound;
+                        settled.push_back(node);
+                    }
+                }
+
+                pendingCount -= ownBuckets[slot].size();
+                ownBuckets[slot].clear();
+            }
+
+            if (frontier.empty())
+                break;
+
+            pendingCount += relaxArcs(frontier, weight, delta, true, threadCount, workspace);
+        }
+
+        pendingCount += relaxArcs(settled, weight, delta, false, threadCount, workspace);
+    }
 }
 
-} // namespace netd
\ No newline at end of file
+} // namespace netd
@@ -0,0 +1,175 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/Project.hpp>
+
+
+namespace netd {
+
+constexpr std::size_t MAX_VERSION_COUNT {100};
+
+bool Project::open(const std::string_view& filename) noexcept
+{
+    m_journal.close();
+    m_undoVersions.clear();
+    m_redoVersions.clear();
+    m_context.m_filename = filename;
+
+    bool isOk = m_parser.parse(m_context, filename);
+
+    m_journal.open(filename);
+    return isOk;
+}
+
+bool Project::save(void) noexcept
+{
+    const auto& filename = m_context.m_filename;
+
+    // wait for journal compaction, since it writes the same project file
+    m_journal.close();
+    m_context.requireAll();
+
+    if (m_writer.save(m_context, filename)) {
+        m_journal.reset(filename);
+        return true;
+    }
+
+    m_journal.open(filename);
+    return false;
+}
+
+void Project::checkpoint(void) noexcept
+{
+    // copy shares all sections, so it costs a few reference counts
+    m_undoVersions.push_back(m_context);
+    m_redoVersions.clear();
+
+    if (m_undoVersions.size() > MAX_VERSION_COUNT)
+        m_undoVersions.erase(m_undoVersions.begin());
+}
+
+bool Project::undo(void) noexcept
+{
+    if (m_undoVersions.empty())
+        return false;
+
+    auto version = std::move(m_undoVersions.back());
+    m_undoVersions.pop_back();
+    m_redoVersions.push_back(m_context);
+
+    restore(std::move(version));
+    return true;
+}
+
+bool Project::redo(void) noexcept
+{
+    if (m_redoVersions.empty())
+        return false;
+
+    auto version = std::move(m_redoVersions.back());
+    m_redoVersions.pop_back();
+    m_undoVersions.push_back(m_context);
+
+    restore(std::move(version));
+    return true;
+}
+
+void Project::discard(void) noexcept
+{
+    if (m_undoVersions.empty())
+        return;
+
+    auto version = std::move(m_undoVersions.back());
+    m_undoVersions.pop_back();
+
+    // dropped edits weren't journaled, so the version is restored as it was
+    version.m_filename = m_context.m_filename;
+    version.m_loader   = m_context.m_loader;
+    m_context          = std::move(version);
+}
+
+void Project::restore(ProjectContext&& version) noexcept
+{
+    auto previous      = m_context;
+    version.m_filename = m_context.m_filename;
+    version.m_loader   = m_context.m_loader;
+    m_context          = std::move(version);
+
+    // section, that wasn't loaded in restored version, wasn't edited
+    // before it, so it is loaded from project file again
+    for (std::size_t i = 0; i < SECTION_COUNT; i++) {
+        if (!m_context.m_isLoaded[i] && previous.m_isLoaded[i])
+            m_context.require(static_cast<Section>(i));
+    }
+
+    // journal sections, that are not shared with previous version
+    if (!m_context.m_nodes.isSame(previous.m_nodes))
+        m_journal.appendNodes(*m_context.m_nodes);
+
+    if (!m_context.m_routers.isSame(previous.m_routers))
+        m_journal.appendRouters(*m_context.m_routers);
+
+    if (!m_context.m_channels.isSame(previous.m_channels))
+        m_journal.appendChannels(*m_context.m_channels);
+
+    if (!m_context.m_edgeTable.isSame(previous.m_edgeTable))
+        m_journal.appendEdgeTable(*m_context.m_edgeTable);
+
+    if (m_context.m_packetSize != previous.m_packetSize)
+        m_journal.appendPacketSize(m_context.m_packetSize);
+
+    appendLoadMatrix(previous.m_loadMatrix);
+}
+
+void Project::appendLoadMatrix(const LoadMatrix& previous) noexcept
+{
+    const auto& matrix = m_context.m_loadMatrix;
+    auto size          = matrix.size1();
+    bool isCleared     = size != previous.size1();
+
+    std::vector<LoadCell> cells;
+
+    // only blocks, that are not shared with previous version, can differ
+    for (std::size_t block = 0; block < matrix.blockCount(); block++) {
+        if (!isCleared && matrix.isSameBlock(previous, block))
+            continue;
+
+        auto first = block * LoadMatrix::BLOCK_ROWS;
+        auto last  = std::min(first + LoadMatrix::BLOCK_ROWS, size);
+
+        for (auto i = first; i < last; i++) {
+            for (std::size_t j = 0; j < size; j++) {
+                auto value = matrix(i, j);
+
+                if (value != (isCleared ? 0 : previous(i, j)))
+                    cells.push_back({static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(j), value});
+            }
+        }
+    }
+
+    if (isCleared || !cells.empty())
+        m_journal.appendLoadCells(size, isCleared, cells);
+}
+
+bool Project::isEmpty(void) const noexcept
+{
+    return m_context.m_filename.empty() && m_context.m_nodes->empty()
+        && m_context.m_routers->empty() && m_context.m_channels->empty();
+}
+
+} // namespace netd
@@ -0,0 +1,165 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/ProjectIndex.hpp>
+#include <filesystem>
+#include <charconv>
+#include <fstream>
+
+
+namespace netd {
+
+constexpr auto INDEX_SUFFIX {".ndidx"};
+
+// project file stamp, index is outdated when it changes
+static bool getStamp(const std::string_view& filename, std::int64_t& size, std::int64_t& time) noexcept
+{
+    std::error_code error;
+    auto path = std::filesystem::path(filename);
+
+    auto fileSize = std::filesystem::file_size(path, error);
+    if (error)
+        return false;
+
+    auto fileTime = std::filesystem::last_write_time(path, error);
+    if (error)
+        return false;
+
+    size = static_cast<std::int64_t>(fileSize);
+    time = static_cast<std::int64_t>(fileTime.time_since_epoch().count());
+
+    return true;
+}
+
+// parse comma separated numbers following "<name>," prefix
+template<typename T>
+static bool parseNumbers(const std::string& line, const std::string_view& name, std::vector<T>& numbers) noexcept
+{
+    if (!line.starts_with(name) || line.size() <= name.size() || line[name.size()] != ',')
+        return false;
+
+    auto ptr = line.data() + name.size() + 1;
+    auto end = line.data() + line.size();
+    T value;
+
+    while (ptr < end) {
+        auto result = std::from_chars(ptr, end, value);
+
+        if (result.ec != std::errc())
+            return false;
+
+        numbers.push_back(value);
+        ptr = (result.ptr < end) ? result.ptr + 1 : end;
+    }
+
+    return true;
+}
+
+ProjectIndex::ProjectIndex(void) noexcept
+{
+    clear();
+}
+
+void ProjectIndex::clear(void) noexcept
+{
+    m_offsets.fill(-1);
+    m_nodeLoads.clear();
+}
+
+std::string ProjectIndex::getPath(const std::string_view& filename) noexcept
+{
+    return std::string(filename) + INDEX_SUFFIX;
+}
+
+bool ProjectIndex::load(const std::string_view& filename) noexcept
+{
+    clear();
+
+    std::int64_t size {0}, time {0};
+    std::ifstream fin(getPath(filename), std::ios::in);
+
+    if (!fin.is_open() || !getStamp(filename, size, time))
+        return false;
+
+    std::vector<std::int64_t> stamp, offsets, count;
+    std::string line;
+
+    std::getline(fin, line); // skip line "# Index"
+
+    bool isOk = std::getline(fin, line) && parseNumbers(line, "size", stamp);
+    isOk = isOk && std::getline(fin, line) && parseNumbers(line, "time", stamp);
+    isOk = isOk && std::getline(fin, line) && parseNumbers(line, "offsets", offsets);
+
+    std::getline(fin, line); // skip line "# Node Loads"
+
+    isOk = isOk && std::getline(fin, line) && parseNumbers(line, "count", count);
+
+    if (!isOk || stamp.size() != 2 || offsets.size() != SECTION_COUNT || count.size() != 1)
+        return false;
+
+    if (stamp[0] != size || stamp[1] != time)
+        return false;
+
+    m_nodeLoads.reserve(static_cast<std::size_t>(count[0]));
+
+    // loads line is not prefixed, so parse it as "loads,<line>"
+    if (std::getline(fin, line) && !parseNumbers("loads," + line, "loads", m_nodeLoads))
+        return false;
+
+    if (m_nodeLoads.size() != static_cast<std::size_t>(count[0])) {
+        clear();
+        return false;
+    }
+
+    std::copy(offsets.begin(), offsets.end(), m_offsets.begin());
+
+    return true;
+}
+
+bool ProjectIndex::save(const std::string_view& filename) const noexcept
+{
+    std::int64_t size {0}, time {0};
+
+    if (!getStamp(filename, size, time))
+        return false;
+
+    std::ofstream fout(getPath(filename), std::ios::out);
+
+    if (!fout.is_open())
+        return false;
+
+    fout << "# Index\n";
+    fout << "size," << size << "\n";
+    fout << "time," << time << "\n";
+    fout << "offsets";
+
+    for (const auto& offset : m_offsets)
+        fout << "," << offset;
+
+    fout << "\n# Node Loads\n";
+    fout << "count," << m_nodeLoads.size() << "\n";
+
+    for (const auto& load : m_nodeLoads)
+        fout << load << ",";
+
+    fout << "\n";
+
+    return fout.good();
+}
+
+} // namespace netd
@@ -0,0 +1,335 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/ProjectJournal.hpp>
+#include <NetDesign/ProjectWriter.hpp>
+#include <filesystem>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <charconv>
+#include <fcntl.h>
+#include <cerrno>
+#include <memory>
+
+
+namespace netd {
+
+constexpr auto JOURNAL_SUFFIX               {".ndjournal"};
+constexpr auto OLD_JOURNAL_SUFFIX           {".ndjournal.old"};
+constexpr std::uint64_t COMPACT_THRESHOLD   {64 * 1024 * 1024};
+constexpr std::size_t MAX_NUMBER_WIDTH      {20};
+
+static std::int32_t openJournal(const std::string& path) noexcept
+{
+    return ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+}
+
+ProjectJournal::~ProjectJournal(void) noexcept
+{
+    close();
+}
+
+std::string ProjectJournal::getPath(const std::string_view& filename) noexcept
+{
+    return std::string(filename) + JOURNAL_SUFFIX;
+}
+
+std::string ProjectJournal::getOldPath(const std::string_view& filename) noexcept
+{
+    return std::string(filename) + OLD_JOURNAL_SUFFIX;
+}
+
+void ProjectJournal::open(const std::string_view& filename) noexcept
+{
+    close();
+
+    m_project = filename;
+    m_fd       = openJournal(getPath(filename));
+    m_isBroken = m_fd < 0;
+
+    struct stat status;
+
+    if (m_fd >= 0 && fstat(m_fd, &status) == 0)
+        m_size = static_cast<std::uint64_t>(status.st_size);
+}
+
+void ProjectJournal::close(void) noexcept
+{
+    wait();
+
+    if (m_fd >= 0)
+        ::close(m_fd);
+
+    m_fd       = -1;
+    m_size     = 0;
+    m_isBroken = false;
+    m_project.clear();
+}
+
+void ProjectJournal::reset(const std::string_view& filename) noexcept
+{
+    close();
+
+    std::error_code error;
+    std::filesystem::remove(getOldPath(filename), error);
+    std::filesystem::remove(getPath(filename), error);
+
+    open(filename);
+}
+
+bool ProjectJournal::isBroken(void) const noexcept
+{
+    return m_isBroken;
+}
+
+void ProjectJournal::wait(void) noexcept
+{
+    if (m_compactor.joinable())
+        m_compactor.join();
+}
+
+void ProjectJournal::put(const std::string_view& str) noexcept
+{
+    m_buffer.append(str);
+}
+
+void ProjectJournal::put(std::uint64_t value) noexcept
+{
+    char number[MAX_NUMBER_WIDTH];
+    auto result = std::to_chars(number, number + MAX_NUMBER_WIDTH, value);
+
+    m_buffer.append(number, result.ptr);
+}
+
+void ProjectJournal::putSection(Section section, std::size_t count) noexcept
+{
+    put(SECTION_NAMES[static_cast<std::size_t>(section)]);
+    put("\ncount,");
+    put(count);
+    put("\n");
+}
+
+bool ProjectJournal::commit(void) noexcept
+{
+    put("\n");
+    put(COMMIT_NAME);
+    put("\n");
+
+    // record is appended at once and synced, so it is either
+    // complete after crash or dropped as torn tail when replayed
+    auto data = m_buffer.data();
+    auto left = m_buffer.size();
+
+    while (left > 0) {
+        auto written = ::write(m_fd, data, left);
+
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        data += written;
+        left -= static_cast<std::size_t>(written);
+    }
+
+    bool isOk = (left == 0) && (fdatasync(m_fd) == 0);
+    auto size = m_buffer.size();
+    m_buffer.clear();
+
+    // journal isn't trusted after failure, so nothing is appended after torn
+    // record, which is cut off or dropped as torn tail when replayed
+    if (!isOk) {
+        [[maybe_unused]] auto result = ftruncate(m_fd, static_cast<off_t>(m_size));
+        ::close(m_fd);
+        m_fd       = -1;
+        m_isBroken = true;
+        return false;
+    }
+
+    m_size += size;
+
+    if (m_size > COMPACT_THRESHOLD)
+        compact();
+
+    return true;
+}
+
+void ProjectJournal::compact(void) noexcept
+{
+    std::error_code error;
+    auto oldPath = getOldPath(m_project);
+
+    // previous compaction is still running or has failed,
+    // in that case journal is dropped by next full save
+    if (m_isCompacting || std::filesystem::exists(oldPath, error))
+        return;
+
+    wait();
+
+    // snapshot already contains records of rotated journal, replaying
+    // them again after crash is harmless, since records are idempotent
+    auto snapshot = m_context->snapshot();
+
+    // rotate journal, records appended from now on go to the new one
+    ::close(m_fd);
+    std::filesystem::rename(getPath(m_project), oldPath, error);
+
+    m_fd       = openJournal(getPath(m_project));
+    m_size     = 0;
+    m_isBroken = m_fd < 0;
+
+    if (error)
+        return;
+
+    m_isCompacting = true;
+
+    m_compactor = std::thread([this, snapshot = std::move(snapshot), project = m_project, oldPath]() {
+        ProjectWriter writer;
+        std::error_code error;
+
+        if (writer.save(*snapshot, project))
+            std::filesystem::remove(oldPath, error);
+
+        m_isCompacting = false;
+    });
+}
+
+bool ProjectJournal::appendNodes(const NodeTable& nodes) noexcept
+{
+    if (m_fd < 0)
+        return !m_isBroken;
+
+    putSection(Section::Nodes, nodes.size());
+    put("id,name,x,y\n");
+
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        put(nodes.id(i));
+        put(",");
+        put(nodes.name(i));
+        put(",");
+        put(nodes.x(i));
+        put(",");
+        put(nodes.y(i));
+        put("\n");
+    }
+
+    return commit();
+}
+
+bool ProjectJournal::appendRouters(const std::vector<Router>& routers) noexcept
+{
+    if (m_fd < 0)
+        return !m_isBroken;
+
+    putSection(Section::Routers, routers.size());
+    put("id,model,capacity,price\n");
+
+    for (const auto& router : routers) {
+        put(router.m_id);
+        put(",");
+        put(router.m_model);
+        put(",");
+        put(router.m_capacity);
+        put(",");
+        put(router.m_price);
+        put("\n");
+    }
+
+    return commit();
+}
+
+bool ProjectJournal::appendChannels(const std::vector<Channel>& channels) noexcept
+{
+    if (m_fd < 0)
+        return !m_isBroken;
+
+    putSection(Section::Channels, channels.size());
+    put("id,capacity,price\n");
+
+    for (const auto& channel : channels) {
+        put(channel.m_id);
+        put(",");
+        put(channel.m_capacity);
+        put(",");
+        put(channel.m_price);
+        put("\n");
+    }
+
+    return commit();
+}
+
+bool ProjectJournal::appendEdgeTable(const EdgeTable& edgeTable) noexcept
+{
+    if (m_fd < 0)
+        return !m_isBroken;
+
+    putSection(Section::EdgeTable, edgeTable.size());
+
+    for (std::size_t i = 0; i < edgeTable.size(); i++) {
+        put(edgeTable.source(i));
+        put(",");
+        put(edgeTable.target(i));
+        put(",");
+        put(edgeTable.channel(i));
+        put(",\n");
+    }
+
+    return commit();
+}
+
+bool ProjectJournal::appendPacketSize(std::uint32_t packetSize) noexcept
+{
+    if (m_fd < 0)
+        return !m_isBroken;
+
+    put(SECTION_NAMES[static_cast<std::size_t>(Section::PacketSize)]);
+    put("\nsize,");
+    put(packetSize);
+    put("\n");
+
+    return commit();
+}
+
+bool ProjectJournal::appendLoadCells(std::size_t size, bool isCleared, const std::vector<LoadCell>& cells) noexcept
+{
+    if (m_fd < 0)
+        return !m_isBroken;
+
+    put(LOAD_CELLS_NAME);
+    put("\nsize,");
+    put(size);
+    put("\nclear,");
+    put(static_cast<std::uint64_t>(isCleared));
+    put("\ncount,");
+    put(cells.size());
+    put("\n");
+
+    for (const auto& cell : cells) {
+        put(cell.m_row);
+        put(",");
+        put(cell.m_column);
+        put(",");
+        put(cell.m_value);
+        put(",\n");
+    }
+
+    return commit();
+}
+
+} // namespace netd
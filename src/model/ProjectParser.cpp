@@ -18,56 +18,255 @@
 
 #include <NetDesign/ProjectContext.hpp>
 #include <NetDesign/ProjectParser.hpp>
-#include <NetDesign/MainWindow.hpp>
-#include <QtWidgets/QMessageBox>
-#include <NetDesign/Utils.hpp>
-#include <print>
+#include <NetDesign/ProjectJournal.hpp>
+#include <filesystem>
+#include <charconv>
 
 
 namespace netd {
 
-static auto& projectContext = ProjectContext::instance();
-
-void ProjectParser::parse(const std::string_view& filename) noexcept
+ProjectParser::~ProjectParser(void) noexcept
 {
-    m_file.open(filename.data(), std::ios::in);
+    if (m_context && m_context->m_loader == this)
+        m_context->m_loader = nullptr;
+}
 
-    if (!m_file.is_open()) {
-        QMessageBox::warning(nullptr, "Error", "Could not open project file.");
-        return;
+bool ProjectParser::parse(ProjectContext& context, const std::string_view& filename) noexcept
+{
+    // close previously opened project
+    if (m_context && m_context->m_loader == this)
+        m_context->m_loader = nullptr;
+
+    m_context = &context;
+    m_context->m_loader = nullptr;
+    m_decompressBuffer.close();
+    m_fileBuffer.close();
+
+    auto compression = getCompression(filename);
+    bool isOpen {false};
+
+    // compressed project is decompressed on separate thread while parsing
+    if (compression == Compression::None) {
+        isOpen = m_fileBuffer.open(filename.data(), std::ios::in) != nullptr;
+        m_file.rdbuf(&m_fileBuffer);
     }
+    else {
+        isOpen = m_decompressBuffer.open(filename, compression);
+        m_file.rdbuf(&m_decompressBuffer);
+    }
+
+    if (!isOpen)
+        return false;
 
-    // clear project context
-    projectContext.m_loadMatrix.clear();
-    projectContext.m_channels.clear();
-    projectContext.m_routers.clear();
-    projectContext.m_nodes.clear();
-    projectContext.m_packetSize = 0;
-    projectContext.m_filename.clear();
+    // clear project context, sections shared with other versions are left intact
+    m_context->m_loadMatrix.resize(0);
+    m_context->m_edgeTable  = {};
+    m_context->m_nodeLoads  = {};
+    m_context->m_channels   = {};
+    m_context->m_routers    = {};
+    m_context->m_nodes      = {};
+    m_context->m_packetSize = 0;
 
     m_line.reserve(256);
 
+    // compressed project can't be read at given offset, so parse it at once
+    if (compression != Compression::None) {
+        while (std::getline(m_file, m_line))
+            parseSection();
+
+        bool isFailed = m_decompressBuffer.isFailed();
+
+        m_decompressBuffer.close();
+        m_context->updateNodeLoads();
+        m_context->m_isLoaded.fill(true);
+
+        replay(ProjectJournal::getOldPath(filename));
+        replay(ProjectJournal::getPath(filename));
+        return !isFailed;
+    }
+
+    // use cached section index or build it with single pass over the file
+    if (!m_index.load(filename)) {
+        buildIndex();
+        m_index.save(filename);
+    }
+
+    // sections are loaded on demand, so project file stays open
+    m_context->m_nodeLoads = m_index.m_nodeLoads;
+    m_context->m_isLoaded.fill(false);
+    m_context->m_loader = this;
+
+    // apply edits made after the last save
+    replay(ProjectJournal::getOldPath(filename));
+    replay(ProjectJournal::getPath(filename));
+
+    return true;
+}
+
+void ProjectParser::replay(const std::string& filename) noexcept
+{
+    std::filebuf journalBuffer;
+
+    if (!journalBuffer.open(filename, std::ios::in))
+        return;
+
+    auto fileBuffer = m_file.rdbuf(&journalBuffer);
+
+    // find journaled sections & end of the last complete record
+    std::array<bool, SECTION_COUNT> isJournaled {}, isPending {};
+    std::int64_t offset {0}, commitOffset {0};
+    bool hasLoadCells {false}, hasPendingCells {false};
+
+    m_file.clear();
+
     while (std::getline(m_file, m_line)) {
-        if (m_line.compare("# Nodes") == 0)
-            parseNodes();
+        offset += static_cast<std::int64_t>(m_line.size()) + 1;
+
+        if (m_line.compare(COMMIT_NAME) == 0) {
+            for (std::size_t i = 0; i < SECTION_COUNT; i++)
+                isJournaled[i] = isJournaled[i] || isPending[i];
 
-        if (m_line.compare("# Load Matrix") == 0)
-            parseLoadMatrix();
+            hasLoadCells    = hasLoadCells || hasPendingCells;
+            hasPendingCells = false;
+            commitOffset    = offset;
+            isPending.fill(false);
+            continue;
+        }
+
+        for (std::size_t i = 0; i < SECTION_COUNT; i++) {
+            if (m_line.compare(SECTION_NAMES[i]) == 0)
+                isPending[i] = true;
+        }
 
-        if (m_line.compare("# Edge Table") == 0)
-            parseEdgeTable();
+        if (m_line.compare(LOAD_CELLS_NAME) == 0)
+            hasPendingCells = true;
+    }
 
-        if (m_line.compare("# Routers") == 0)
-            parseRouters();
+    // drop torn tail of record interrupted by crash
+    journalBuffer.close();
+    m_file.rdbuf(fileBuffer);
 
-        if (m_line.compare("# Channels") == 0)
-            parseChannels();
+    std::error_code error;
+    auto path = std::filesystem::path(filename);
 
-        if (m_line.compare("# Packet Size") == 0)
-            projectContext.m_packetSize = parseCount();
+    if (std::filesystem::file_size(path, error) != static_cast<std::uintmax_t>(commitOffset) && !error)
+        std::filesystem::resize_file(path, static_cast<std::uintmax_t>(commitOffset), error);
+
+    // load cells change the load matrix, so it must be loaded first,
+    // while journaled sections replace ones from project file
+    if (hasLoadCells)
+        m_context->require(Section::LoadMatrix);
+
+    for (std::size_t i = 0; i < SECTION_COUNT; i++) {
+        if (isJournaled[i])
+            m_context->m_isLoaded[i] = true;
     }
 
-    m_file.close();
+    if (!journalBuffer.open(filename, std::ios::in))
+        return;
+
+    m_file.rdbuf(&journalBuffer);
+    m_file.clear();
+
+    while (std::getline(m_file, m_line))
+        parseSection();
+
+    m_file.rdbuf(fileBuffer);
+    m_file.clear();
+}
+
+void ProjectParser::load(Section section) noexcept
+{
+    auto offset = m_index.m_offsets[static_cast<std::size_t>(section)];
+
+    if (offset < 0)
+        return;
+
+    m_file.clear();
+    m_file.seekg(offset);
+
+    if (std::getline(m_file, m_line))
+        parseSection();
+}
+
+void ProjectParser::parseSection(void) noexcept
+{
+    if (m_line.compare("# Nodes") == 0)
+        parseNodes();
+
+    if (m_line.compare("# Load Matrix") == 0)
+        parseLoadMatrix();
+
+    if (m_line.compare("# Edge Table") == 0)
+        parseEdgeTable();
+
+    if (m_line.compare("# Routers") == 0)
+        parseRouters();
+
+    if (m_line.compare("# Channels") == 0)
+        parseChannels();
+
+    if (m_line.compare("# Packet Size") == 0)
+        m_context->m_packetSize = parseCount();
+
+    if (m_line.compare(LOAD_CELLS_NAME) == 0)
+        parseLoadCells();
+}
+
+void ProjectParser::buildIndex(void) noexcept
+{
+    std::int64_t offset {0};
+    m_index.clear();
+
+    m_file.clear();
+    m_file.seekg(0);
+
+    auto readLine = [this, &offset]() {
+        if (!std::getline(m_file, m_line))
+            return false;
+
+        offset += static_cast<std::int64_t>(m_line.size()) + 1;
+        return true;
+    };
+
+    // parse comma separated numbers of line, returning their sum
+    auto sumLine = [this](std::size_t skip) {
+        const char *ptr = m_line.data() + std::min(skip, m_line.size());
+        const char *end = m_line.data() + m_line.size();
+        std::uint32_t sum {0}, value {0};
+
+        while (ptr < end) {
+            auto result = std::from_chars(ptr, end, value);
+
+            if (result.ec != std::errc())
+                break;
+
+            sum += value;
+            ptr  = (result.ptr < end) ? result.ptr + 1 : end;
+        }
+
+        return sum;
+    };
+
+    auto lineOffset = offset;
+
+    while (readLine()) {
+        for (std::size_t i = 0; i < SECTION_COUNT; i++) {
+            if (m_line.compare(SECTION_NAMES[i]) == 0)
+                m_index.m_offsets[i] = lineOffset;
+        }
+
+        // only sums of load matrix rows are needed without loading the matrix
+        if (m_line.compare("# Load Matrix") == 0 && readLine()) {
+            auto matrixCount = sumLine(m_line.find(',') + 1);
+            m_index.m_nodeLoads.reserve(matrixCount);
+
+            for (std::uint32_t i = 0; i < matrixCount && readLine(); i++)
+                m_index.m_nodeLoads.push_back(sumLine(0));
+        }
+
+        lineOffset = offset;
+    }
 }
 
 std::uint32_t ProjectParser::parseCount(void) noexcept
@@ -88,8 +287,10 @@ std::uint32_t ProjectParser::parseCount(void) noexcept
 void ProjectParser::parseNodes(void) noexcept
 {
     auto nodeCount = parseCount();
+    NodeTable nodes;
+
     if (nodeCount)
-        projectContext.m_nodes.reserve(nodeCount);
+        nodes.reserve(nodeCount);
 
     std::getline(m_file, m_line); // skip line "id,name,x,y"
 
@@ -106,18 +307,19 @@ void ProjectParser::parseNodes(void) noexcept
         m_iss >> node.m_x >> delim;
         m_iss >> node.m_y >> delim;
 
-        projectContext.m_nodes.push_back(node);
+        nodes.push_back(node);
         i++;
     }
+
+    m_context->m_nodes = std::move(nodes);
 }
 
 void ProjectParser::parseLoadMatrix(void) noexcept
 {
     auto matrixCount = parseCount();
-    if (matrixCount)
-        projectContext.m_loadMatrix.resize(matrixCount, matrixCount);
+    auto& matrix     = m_context->m_loadMatrix;
+    matrix.resize(matrixCount);
 
-    std::uint32_t value;
     char delim;
 
     for (std::uint32_t i = 0; i < matrixCount; i++) {
@@ -125,20 +327,20 @@ void ProjectParser::parseLoadMatrix(void) noexcept
         m_iss.clear();
         m_iss.str(m_line);
 
-        for (std::uint32_t j = 0; j < matrixCount; j++) {
-            m_iss >> value >> delim;
-            projectContext.m_loadMatrix(i, j) = value;
-        }
+        auto row = matrix.editRow(i);
+
+        for (std::uint32_t j = 0; j < matrixCount; j++)
+            m_iss >> row[j] >> delim;
     }
 }
 
 void ProjectParser::parseEdgeTable(void) noexcept
 {
     auto matrixCount = parseCount();
-    if (matrixCount)
-        projectContext.m_edgeTable.resize(matrixCount, 3);
+    EdgeTable edgeTable;
+    edgeTable.reserve(matrixCount);
 
-    std::uint32_t value;
+    Edge edge;
     char delim;
 
     for (std::uint32_t i = 0; i < matrixCount; i++) {
@@ -146,18 +348,57 @@ void ProjectParser::parseEdgeTable(void) noexcept
         m_iss.clear();
         m_iss.str(m_line);
 
-        for (std::uint32_t j = 0; j < 3; j++) {
-            m_iss >> value >> delim;
-            projectContext.m_edgeTable(i, j) = value;
-        }
+        m_iss >> edge.m_source >> delim;
+        m_iss >> edge.m_target >> delim;
+        m_iss >> edge.m_channel >> delim;
+
+        edgeTable.push_back(edge);
+    }
+
+    m_context->m_edgeTable = std::move(edgeTable);
+}
+
+void ProjectParser::parseLoadCells(void) noexcept
+{
+    auto& loadMatrix = m_context->m_loadMatrix;
+
+    auto size      = parseCount();
+    auto isCleared = parseCount();
+    auto cellCount = parseCount();
+
+    if (isCleared || loadMatrix.size1() != size) {
+        loadMatrix.resize(size);
+        m_context->updateNodeLoads();
+    }
+
+    auto& nodeLoads = m_context->m_nodeLoads.edit();
+
+    std::uint32_t row, column, value;
+    char delim;
+
+    for (std::uint32_t i = 0; i < cellCount && std::getline(m_file, m_line); i++) {
+        m_iss.clear();
+        m_iss.str(m_line);
+
+        m_iss >> row >> delim >> column >> delim >> value >> delim;
+
+        if (row >= size || column >= size)
+            continue;
+
+        if (row < nodeLoads.size())
+            nodeLoads[row] += value - loadMatrix(row, column);
+
+        loadMatrix.set(row, column, value);
     }
 }
 
 void ProjectParser::parseRouters(void) noexcept
 {
     auto routerCount = parseCount();
+    std::vector<Router> routers;
+
     if (routerCount)
-        projectContext.m_routers.reserve(routerCount);
+        routers.reserve(routerCount);
 
     std::getline(m_file, m_line); // skip line
 
@@ -174,16 +415,20 @@ void ProjectParser::parseRouters(void) noexcept
         m_iss >> router.m_capacity >> delim;
         m_iss >> router.m_price    >> delim;
 
-        projectContext.m_routers.push_back(router);
+        routers.push_back(router);
         i++;
     }
+
+    m_context->m_routers = std::move(routers);
 }
 
 void ProjectParser::parseChannels(void) noexcept
 {
     auto channelCount = parseCount();
+    std::vector<Channel> channels;
+
     if (channelCount)
-        projectContext.m_channels.reserve(channelCount);
+        channels.reserve(channelCount);
 
     std::getline(m_file, m_line); // skip line
 
@@ -199,9 +444,11 @@ void ProjectParser::parseChannels(void) noexcept
         m_iss >> channel.m_capacity >> delim;
         m_iss >> channel.m_price    >> delim;
 
-        projectContext.m_channels.push_back(channel);
+        channels.push_back(channel);
         i++;
     }
+
+    m_context->m_channels = std::move(channels);
 }
 
 } // namespace netd
\ No newline at end of file
@@ -0,0 +1,350 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/iostreams/device/file_descriptor.hpp>
+#include <NetDesign/ProjectContext.hpp>
+#include <NetDesign/ProjectWriter.hpp>
+#include <filesystem>
+#include <sys/stat.h>
+#include <algorithm>
+#include <unistd.h>
+#include <charconv>
+#include <fcntl.h>
+#include <thread>
+
+
+namespace netd {
+
+constexpr std::size_t BUFFER_SIZE        {4 * 1024 * 1024};
+constexpr std::size_t MAX_NUMBER_WIDTH   {20};
+constexpr std::size_t ROWS_PER_TASK      {32};
+constexpr std::size_t PARALLEL_MIN_CELLS {1 << 16};
+
+static void formatRows(std::string& out, std::uint32_t *loads, const LoadMatrix& matrix,
+                       std::size_t first, std::size_t last) noexcept
+{
+    auto columns  = matrix.size2();
+    auto maxWidth = (last - first) * (columns * (MAX_NUMBER_WIDTH + 1) + 1);
+
+    out.clear();
+    out.resize_and_overwrite(maxWidth, [&](char *buffer, std::size_t size) {
+        auto end = buffer + size;
+        auto ptr = buffer;
+
+        for (std::size_t i = first; i < last; i++) {
+            auto row = matrix.row(i);
+            std::uint32_t load {0};
+
+            for (std::size_t j = 0; j < columns; j++) {
+                ptr    = std::to_chars(ptr, end, row[j]).ptr;
+                *ptr++ = ',';
+                load  += row[j];
+            }
+            *ptr++   = '\n';
+            loads[i] = load;
+        }
+
+        return static_cast<std::size_t>(ptr - buffer);
+    });
+}
+
+static bool syncDirectory(const std::string& filename) noexcept
+{
+    auto directory = std::filesystem::path(filename).parent_path();
+
+    if (directory.empty())
+        directory = ".";
+
+    auto fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    if (fd < 0)
+        return false;
+
+    bool isOk = fsync(fd) == 0;
+    ::close(fd);
+
+    return isOk;
+}
+
+bool ProjectWriter::save(const ProjectContext& context, const std::string_view& filename) noexcept
+{
+    std::string target {filename};
+    std::string temporary = target + ".XXXXXX";
+    m_context = &context;
+
+    // unique name, so saves of the same project, e.g. by journal compaction, don't collide
+    auto fd = mkstemp(temporary.data());
+
+    if (fd < 0)
+        return false;
+
+    fchmod(fd, 0644);
+    m_file = fdopen(fd, "wb");
+
+    if (!m_file) {
+        std::error_code error;
+
+        ::close(fd);
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    // data is already buffered, so disable stdio buffering
+    std::setvbuf(m_file, nullptr, _IONBF, 0);
+    m_buffer.reserve(BUFFER_SIZE);
+    m_index.clear();
+    m_offset = 0;
+    m_isOk   = true;
+
+    auto compression = getCompression(target);
+
+    if (compression != Compression::None) {
+        namespace io = boost::iostreams;
+
+        pushCompressor(m_stream, compression);
+        m_stream.push(io::file_descriptor_sink(fileno(m_file), io::never_close_handle));
+    }
+
+    writeNodes();
+    writeLoadMatrix();
+    writeEdgeTable();
+    writeRouters();
+    writeChannels();
+
+    put("\n");
+    putSection(Section::PacketSize);
+    put("size,");
+    put(m_context->m_packetSize);
+    put("\n");
+    flush();
+
+    // write compressed stream trailer
+    if (!m_stream.empty()) {
+        try {
+            m_stream.reset();
+        }
+        catch (...) {
+            m_isOk = false;
+        }
+    }
+
+    // make sure data reached the disk before replacing project file
+    m_isOk = m_isOk && (std::fflush(m_file) == 0) && (fsync(fileno(m_file)) == 0);
+    m_isOk = (std::fclose(m_file) == 0) && m_isOk;
+    m_file = nullptr;
+
+    std::error_code error;
+
+    if (m_isOk)
+        std::filesystem::rename(temporary, target, error);
+
+    if (!m_isOk || error) {
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    // rename is durable only once directory entry reaches the disk
+    if (!syncDirectory(target))
+        return false;
+
+    // compressed file can't be read at given offset
+    if (compression == Compression::None)
+        m_index.save(target);
+    else
+        std::filesystem::remove(ProjectIndex::getPath(target), error);
+
+    return true;
+}
+
+void ProjectWriter::putSection(Section section) noexcept
+{
+    auto offset = m_offset + static_cast<std::int64_t>(m_buffer.size());
+    m_index.m_offsets[static_cast<std::size_t>(section)] = offset;
+
+    put(SECTION_NAMES[static_cast<std::size_t>(section)]);
+    put("\n");
+}
+
+void ProjectWriter::put(const std::string_view& str) noexcept
+{
+    if (m_buffer.size() + str.size() > BUFFER_SIZE)
+        flush();
+
+    if (str.size() > BUFFER_SIZE)
+        write(str);
+    else
+        m_buffer.append(str);
+}
+
+void ProjectWriter::put(std::uint64_t value) noexcept
+{
+    char number[MAX_NUMBER_WIDTH];
+    auto result = std::to_chars(number, number + MAX_NUMBER_WIDTH, value);
+
+    put(std::string_view(number, result.ptr));
+}
+
+void ProjectWriter::write(const std::string_view& data) noexcept
+{
+    if (!m_isOk || data.empty())
+        return;
+
+    m_offset += static_cast<std::int64_t>(data.size());
+
+    if (!m_stream.empty()) {
+        m_stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+        m_isOk = m_stream.good();
+    }
+    else if (std::fwrite(data.data(), 1, data.size(), m_file) != data.size())
+        m_isOk = false;
+}
+
+void ProjectWriter::flush(void) noexcept
+{
+    write(m_buffer);
+    m_buffer.clear();
+}
+
+void ProjectWriter::writeNodes(void) noexcept
+{
+    putSection(Section::Nodes);
+    put("count,");
+    put(m_context->m_nodes->size());
+    put("\nid,name,x,y\n");
+
+    const auto& nodes = *m_context->m_nodes;
+
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        put(nodes.id(i));
+        put(",");
+        put(nodes.name(i));
+        put(",");
+        put(nodes.x(i));
+        put(",");
+        put(nodes.y(i));
+        put("\n");
+    }
+    put("\n");
+}
+
+void ProjectWriter::writeLoadMatrix(void) noexcept
+{
+    const auto& matrix = m_context->m_loadMatrix;
+    auto matrixCount   = matrix.size1();
+
+    putSection(Section::LoadMatrix);
+    put("count,");
+    put(matrixCount);
+    put("\n");
+
+    std::size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    if (matrixCount * matrix.size2() < PARALLEL_MIN_CELLS)
+        threadCount = 1;
+
+    m_rowBuffers.resize(threadCount);
+    m_index.m_nodeLoads.resize(matrixCount);
+
+    auto loads = m_index.m_nodeLoads.data();
+
+    // each round every thread formats its own block of rows,
+    // then blocks are written in order
+    auto rowsPerRound = ROWS_PER_TASK * threadCount;
+
+    for (std::size_t first = 0; first < matrixCount; first += rowsPerRound) {
+        auto roundEnd = std::min(first + rowsPerRound, matrixCount);
+
+        {
+            std::vector<std::jthread> workers;
+
+            for (std::size_t t = 1; t < threadCount; t++) {
+                auto begin = std::min(first + t * ROWS_PER_TASK, roundEnd);
+                auto end   = std::min(begin + ROWS_PER_TASK, roundEnd);
+
+                workers.emplace_back(formatRows, std::ref(m_rowBuffers[t]), loads, std::cref(matrix), begin, end);
+            }
+
+            formatRows(m_rowBuffers[0], loads, matrix, first, std::min(first + ROWS_PER_TASK, roundEnd));
+        }
+
+        flush();
+        for (const auto& block : m_rowBuffers)
+            write(block);
+    }
+    put("\n");
+}
+
+void ProjectWriter::writeEdgeTable(void) noexcept
+{
+    const auto& edgeTable = *m_context->m_edgeTable;
+    auto edgeCount        = edgeTable.size();
+
+    putSection(Section::EdgeTable);
+    put("count,");
+    put(edgeCount);
+    put("\n");
+
+    for (std::size_t i = 0; i < edgeCount; i++) {
+        put(edgeTable.source(i));
+        put(",");
+        put(edgeTable.target(i));
+        put(",");
+        put(edgeTable.channel(i));
+        put(",\n");
+    }
+    put("\n");
+}
+
+void ProjectWriter::writeRouters(void) noexcept
+{
+    putSection(Section::Routers);
+    put("count,");
+    put(m_context->m_routers->size());
+    put("\nid,model,capacity,price\n");
+
+    for (const auto& router : *m_context->m_routers) {
+        put(router.m_id);
+        put(",");
+        put(router.m_model);
+        put(",");
+        put(router.m_capacity);
+        put(",");
+        put(router.m_price);
+        put("\n");
+    }
+    put("\n");
+}
+
+void ProjectWriter::writeChannels(void) noexcept
+{
+    putSection(Section::Channels);
+    put("count,");
+    put(m_context->m_channels->size());
+    put("\nid,capacity,price\n");
+
+    for (const auto& channel : *m_context->m_channels) {
+        put(channel.m_id);
+        put(",");
+        put(channel.m_capacity);
+        put(",");
+        put(channel.m_price);
+        put("\n");
+    }
+}
+
+} // namespace netd
@@ -0,0 +1,114 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/SpatialIndex.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <iterator>
+
+
+namespace netd {
+
+namespace bg  = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+void SpatialIndex::set(const NodeTable& nodes, const EdgeTable& edgeTable) noexcept
+{
+    std::vector<NodeValue> nodeValues;
+    std::vector<EdgeValue> edgeValues;
+
+    nodeValues.reserve(nodes.size());
+    edgeValues.reserve(edgeTable.size());
+
+    for (std::uint32_t i = 0; i < nodes.size(); i++)
+        nodeValues.emplace_back(Point(nodes.x(i), nodes.y(i)), i);
+
+    for (std::size_t i = 0; i < edgeTable.size(); i++) {
+        auto src  = edgeTable.source(i);
+        auto dest = edgeTable.target(i);
+
+        if (src >= nodes.size() || dest >= nodes.size())
+            continue;
+
+        Segment segment(Point(nodes.x(src), nodes.y(src)), Point(nodes.x(dest), nodes.y(dest)));
+        edgeValues.emplace_back(segment, static_cast<std::uint32_t>(i));
+    }
+
+    // range constructor packs tree, which is faster to build & to query
+    m_nodes = decltype(m_nodes)(nodeValues);
+    m_edges = decltype(m_edges)(edgeValues);
+}
+
+void SpatialIndex::clear(void) noexcept
+{
+    m_nodes.clear();
+    m_edges.clear();
+}
+
+bool SpatialIndex::empty(void) const noexcept
+{
+    return m_nodes.empty();
+}
+
+SpatialBounds SpatialIndex::bounds(void) const noexcept
+{
+    if (m_nodes.empty())
+        return {};
+
+    auto box = m_nodes.bounds();
+    return {bg::get<bg::min_corner, 0>(box), bg::get<bg::min_corner, 1>(box),
+            bg::get<bg::max_corner, 0>(box), bg::get<bg::max_corner, 1>(box)};
+}
+
+std::optional<std::uint32_t> SpatialIndex::findNode(double x, double y, double maxDistance) const noexcept
+{
+    Point point(x, y);
+    std::vector<NodeValue> result;
+
+    m_nodes.query(bgi::nearest(point, 1), std::back_inserter(result));
+
+    if (result.empty() || bg::distance(point, result.front().first) > maxDistance)
+        return std::nullopt;
+
+    return result.front().second;
+}
+
+std::optional<std::uint32_t> SpatialIndex::findEdge(double x, double y, double maxDistance) const noexcept
+{
+    Point point(x, y);
+    std::vector<EdgeValue> result;
+
+    // nearest query measures distance to segments themselves, not to their boxes
+    m_edges.query(bgi::nearest(point, 1), std::back_inserter(result));
+
+    if (result.empty() || bg::distance(point, result.front().first) > maxDistance)
+        return std::nullopt;
+
+    return result.front().second;
+}
+
+void SpatialIndex::findNodes(const SpatialBounds& bounds, std::vector<std::uint32_t>& nodes) const noexcept
+{
+    Box box(Point(bounds.m_minX, bounds.m_minY), Point(bounds.m_maxX, bounds.m_maxY));
+    nodes.clear();
+
+    for (auto it = m_nodes.qbegin(bgi::covered_by(box)); it != m_nodes.qend(); ++it)
+        nodes.push_back(it->second);
+}
+
+} // namespace netd
@@ -0,0 +1,413 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/TopologyParser.hpp>
+#include <QtCore/QXmlStreamReader>
+#include <QtCore/QFile>
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <limits>
+#include <cctype>
+
+
+namespace netd {
+
+constexpr std::size_t GML_BUFFER_SIZE {1024 * 1024};
+constexpr double GEO_SCALE            {10.0}; // scene units per degree
+
+enum class GmlToken {
+    End,
+    Open,
+    Close,
+    Word,
+    String,
+};
+
+TopologyFormat getTopologyFormat(const std::string_view& filename) noexcept
+{
+    if (filename.ends_with(".gml"))
+        return TopologyFormat::Gml;
+
+    return TopologyFormat::GraphML;
+}
+
+static bool isName(const std::string_view& name, const std::string_view& expected) noexcept
+{
+    return std::ranges::equal(name, expected, [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == b;
+    });
+}
+
+static double toNumber(const std::string_view& value) noexcept
+{
+    double number {0.0};
+    std::from_chars(value.data(), value.data() + value.size(), number);
+
+    return number;
+}
+
+// saturate number, so that it fits into project field
+static std::uint32_t toUnsigned(double value) noexcept
+{
+    constexpr auto max = static_cast<double>(std::numeric_limits<std::uint32_t>::max());
+    return static_cast<std::uint32_t>(std::clamp(value, 0.0, max));
+}
+
+static GmlToken readToken(std::streambuf& buffer, std::string& token) noexcept
+{
+    using Traits = std::streambuf::traits_type;
+    auto ch = buffer.sbumpc();
+
+    // skip whitespaces & comments
+    while (ch != Traits::eof()) {
+        if (ch == '#') {
+            while (ch != Traits::eof() && ch != '\n')
+                ch = buffer.sbumpc();
+            continue;
+        }
+
+        if (!std::isspace(ch))
+            break;
+
+        ch = buffer.sbumpc();
+    }
+
+    if (ch == Traits::eof())
+        return GmlToken::End;
+
+    if (ch == '[')
+        return GmlToken::Open;
+
+    if (ch == ']')
+        return GmlToken::Close;
+
+    token.clear();
+
+    if (ch == '"') {
+        while ((ch = buffer.sbumpc()) != Traits::eof() && ch != '"')
+            token.push_back(static_cast<char>(ch));
+
+        return GmlToken::String;
+    }
+
+    token.push_back(static_cast<char>(ch));
+
+    while ((ch = buffer.sgetc()) != Traits::eof() && !std::isspace(ch) && ch != '[' && ch != ']') {
+        token.push_back(static_cast<char>(ch));
+        buffer.sbumpc();
+    }
+
+    return GmlToken::Word;
+}
+
+bool TopologyParser::parse(ProjectContext& context, const std::string_view& filename) noexcept
+{
+    m_context = &context;
+    m_nodePositions.clear();
+    m_channelPositions.clear();
+    m_keyNames.clear();
+    m_edges     = {};
+    m_isRenamed = false;
+
+    bool isOk {false};
+
+    if (getTopologyFormat(filename) == TopologyFormat::Gml)
+        isOk = parseGml(filename);
+    else
+        isOk = parseGraphML(filename);
+
+    // release lookup tables of large topology
+    m_nodePositions    = {};
+    m_channelPositions = {};
+    m_edges            = {};
+
+    return isOk;
+}
+
+void TopologyParser::clear(void) noexcept
+{
+    auto& context = *m_context;
+
+    context.m_nodes     = {};
+    context.m_channels  = {};
+    context.m_edgeTable = {};
+    context.m_nodeLoads = {};
+    context.m_loadMatrix.resize(0);
+
+    // imported sections replace ones of project file
+    context.m_isLoaded[static_cast<std::size_t>(Section::Nodes)]      = true;
+    context.m_isLoaded[static_cast<std::size_t>(Section::LoadMatrix)] = true;
+    context.m_isLoaded[static_cast<std::size_t>(Section::EdgeTable)]  = true;
+    context.m_isLoaded[static_cast<std::size_t>(Section::Channels)]   = true;
+}
+
+void TopologyParser::finish(void) noexcept
+{
+    m_context->m_edgeTable = std::move(m_edges);
+}
+
+bool TopologyParser::isRenamed(void) const noexcept
+{
+    return m_isRenamed;
+}
+
+std::string TopologyParser::toNodeName(const std::string_view& name) noexcept
+{
+    std::string result(name);
+
+    if (result.find_first_of(",\r\n") == std::string::npos)
+        return result;
+
+    // commas & line breaks are separators of project file
+    std::ranges::replace(result, ',', ';');
+    std::ranges::replace(result, '\r', ' ');
+    std::ranges::replace(result, '\n', ' ');
+    m_isRenamed = true;
+
+    return result;
+}
+
+std::uint32_t TopologyParser::nodePosition(const std::string& id) noexcept
+{
+    auto& nodes    = m_context->m_nodes.edit();
+    auto position  = static_cast<std::uint32_t>(nodes.size());
+    auto [it, isInserted] = m_nodePositions.try_emplace(id, position);
+
+    // edge may refer to node declared later, node name defaults to its id
+    if (isInserted)
+        nodes.push_back({toNodeName(id), position + 1, 0, 0});
+
+    return it->second;
+}
+
+std::uint32_t TopologyParser::channelPosition(void) noexcept
+{
+    auto& channels = m_context->m_channels.edit();
+    auto position  = static_cast<std::uint32_t>(channels.size());
+    auto key       = (static_cast<std::uint64_t>(m_capacity) << 32) | m_price;
+    auto [it, isInserted] = m_channelPositions.try_emplace(key, position);
+
+    if (isInserted)
+        channels.push_back({m_capacity, m_price, position + 1});
+
+    return it->second;
+}
+
+void TopologyParser::setNodeAttribute(const std::string_view& name, const std::string_view& value) noexcept
+{
+    if (isName(name, "id"))
+        m_nodeId = value;
+    else if (isName(name, "label") || isName(name, "name"))
+        m_node.m_name = toNodeName(value);
+    else if (isName(name, "x"))
+        m_node.m_x = toUnsigned(toNumber(value));
+    else if (isName(name, "y"))
+        m_node.m_y = toUnsigned(toNumber(value));
+    else if (isName(name, "longitude"))
+        m_node.m_x = toUnsigned((toNumber(value) + 180.0) * GEO_SCALE);
+    else if (isName(name, "latitude"))
+        m_node.m_y = toUnsigned((90.0 - toNumber(value)) * GEO_SCALE);
+}
+
+void TopologyParser::setEdgeAttribute(const std::string_view& name, const std::string_view& value) noexcept
+{
+    if (isName(name, "source"))
+        m_source = value;
+    else if (isName(name, "target"))
+        m_target = value;
+    else if (isName(name, "capacity") || isName(name, "bandwidth") || isName(name, "linkspeedraw"))
+        m_capacity = toUnsigned(toNumber(value));
+    else if (isName(name, "price") || isName(name, "cost"))
+        m_price = toUnsigned(toNumber(value));
+}
+
+void TopologyParser::beginNode(void) noexcept
+{
+    m_nodeId.clear();
+    m_node = {};
+}
+
+void TopologyParser::endNode(void) noexcept
+{
+    auto position = nodePosition(m_nodeId);
+    auto& nodes   = m_context->m_nodes.edit();
+
+    if (!m_node.m_name.empty())
+        nodes.setName(position, m_node.m_name);
+
+    nodes.setPosition(position, m_node.m_x, m_node.m_y);
+}
+
+void TopologyParser::beginEdge(void) noexcept
+{
+    m_source.clear();
+    m_target.clear();
+    m_capacity = 0;
+    m_price    = 0;
+}
+
+void TopologyParser::endEdge(void) noexcept
+{
+    if (m_source.empty() || m_target.empty())
+        return;
+
+    m_edges.push_back({nodePosition(m_source), nodePosition(m_target), channelPosition()});
+}
+
+bool TopologyParser::parseGraphML(const std::string_view& filename) noexcept
+{
+    QFile file(QString::fromUtf8(filename.data(), static_cast<qsizetype>(filename.size())));
+
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    clear();
+
+    enum class Element {None, Node, Edge} element {Element::None};
+    QXmlStreamReader xml(&file);
+
+    // elements are read one by one, without building document tree
+    while (!xml.atEnd()) {
+        auto token = xml.readNext();
+        auto name  = xml.name();
+
+        if (token == QXmlStreamReader::EndElement) {
+            if (element == Element::Node && name == QLatin1String("node"))
+                endNode();
+
+            if (element == Element::Edge && name == QLatin1String("edge"))
+                endEdge();
+
+            if (name == QLatin1String("node") || name == QLatin1String("edge"))
+                element = Element::None;
+
+            continue;
+        }
+
+        if (token != QXmlStreamReader::StartElement)
+            continue;
+
+        auto attributes = xml.attributes();
+
+        if (name == QLatin1String("key")) {
+            auto id       = attributes.value("id").toString().toStdString();
+            m_keyNames[id] = attributes.value("attr.name").toString().toStdString();
+        }
+        else if (name == QLatin1String("node")) {
+            beginNode();
+            m_nodeId = attributes.value("id").toString().toStdString();
+            element  = Element::Node;
+        }
+        else if (name == QLatin1String("edge")) {
+            beginEdge();
+            m_source = attributes.value("source").toString().toStdString();
+            m_target = attributes.value("target").toString().toStdString();
+            element  = Element::Edge;
+        }
+        else if (name == QLatin1String("data") && element != Element::None) {
+            auto key   = attributes.value("key").toString().toStdString();
+            auto it    = m_keyNames.find(key);
+            auto value = xml.readElementText(QXmlStreamReader::SkipChildElements).toStdString();
+
+            const auto& keyName = (it != m_keyNames.end()) ? it->second : key;
+
+            // node id comes from element attribute only
+            if (element == Element::Node && !isName(keyName, "id"))
+                setNodeAttribute(keyName, value);
+
+            if (element == Element::Edge)
+                setEdgeAttribute(keyName, value);
+        }
+    }
+
+    finish();
+    return !xml.hasError();
+}
+
+bool TopologyParser::parseGml(const std::string_view& filename) noexcept
+{
+    std::filebuf buffer;
+    std::vector<char> storage(GML_BUFFER_SIZE);
+
+    buffer.pubsetbuf(storage.data(), static_cast<std::streamsize>(storage.size()));
+
+    if (!buffer.open(std::string(filename), std::ios::in))
+        return false;
+
+    clear();
+
+    // keys of opened lists, e.g. "graph", "node", "graphics"
+    std::vector<std::string> path;
+    std::string key, token;
+    bool hasKey {false};
+
+    auto isIn = [&path](const std::string_view& element) {
+        return path.size() >= 2 && path[0] == "graph" && path[1] == element;
+    };
+
+    for (auto type = readToken(buffer, token); type != GmlToken::End; type = readToken(buffer, token)) {
+        if (type == GmlToken::Open) {
+            path.push_back(hasKey ? key : std::string());
+            hasKey = false;
+
+            if (path.size() == 2 && isIn("node"))
+                beginNode();
+
+            if (path.size() == 2 && isIn("edge"))
+                beginEdge();
+
+            continue;
+        }
+
+        if (type == GmlToken::Close) {
+            if (path.empty())
+                break;
+
+            if (path.size() == 2 && isIn("node"))
+                endNode();
+
+            if (path.size() == 2 && isIn("edge"))
+                endEdge();
+
+            path.pop_back();
+            hasKey = false;
+            continue;
+        }
+
+        if (!hasKey) {
+            key    = token;
+            hasKey = true;
+            continue;
+        }
+
+        hasKey = false;
+
+        // node position is kept in nested "graphics" list
+        if (isIn("node") && (path.size() == 2 || path[2] == "graphics"))
+            setNodeAttribute(key, token);
+
+        if (isIn("edge") && path.size() == 2)
+            setEdgeAttribute(key, token);
+    }
+
+    finish();
+    return path.empty() && !hasKey;
+}
+
+} // namespace netd
@@ -0,0 +1,202 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/TopologyWriter.hpp>
+#include <QtCore/QXmlStreamWriter>
+#include <QtCore/QSaveFile>
+#include <algorithm>
+#include <charconv>
+
+
+namespace netd {
+
+constexpr std::size_t GML_BUFFER_SIZE  {1024 * 1024};
+constexpr std::size_t MAX_NUMBER_WIDTH {20};
+
+static QString getNodeId(std::uint32_t position) noexcept
+{
+    return "n" + QString::number(position);
+}
+
+static void writeKey(QXmlStreamWriter& xml, const QString& name, const QString& domain, const QString& type) noexcept
+{
+    xml.writeStartElement("key");
+    xml.writeAttribute("id", name);
+    xml.writeAttribute("for", domain);
+    xml.writeAttribute("attr.name", name);
+    xml.writeAttribute("attr.type", type);
+    xml.writeEndElement();
+}
+
+static void writeData(QXmlStreamWriter& xml, const QString& key, const QString& value) noexcept
+{
+    xml.writeStartElement("data");
+    xml.writeAttribute("key", key);
+    xml.writeCharacters(value);
+    xml.writeEndElement();
+}
+
+bool TopologyWriter::save(const ProjectContext& context, const std::string_view& filename) noexcept
+{
+    if (getTopologyFormat(filename) == TopologyFormat::Gml)
+        return saveGml(context, filename);
+
+    return saveGraphML(context, filename);
+}
+
+bool TopologyWriter::saveGraphML(const ProjectContext& context, const std::string_view& filename) noexcept
+{
+    // file is replaced only after it was written completely
+    QSaveFile file(QString::fromUtf8(filename.data(), static_cast<qsizetype>(filename.size())));
+
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QXmlStreamWriter xml(&file);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument();
+    xml.writeStartElement("graphml");
+    xml.writeDefaultNamespace("http://graphml.graphdrawing.org/xmlns");
+
+    writeKey(xml, "label", "node", "string");
+    writeKey(xml, "x", "node", "int");
+    writeKey(xml, "y", "node", "int");
+    writeKey(xml, "capacity", "edge", "long");
+    writeKey(xml, "price", "edge", "long");
+
+    xml.writeStartElement("graph");
+    xml.writeAttribute("id", "G");
+    xml.writeAttribute("edgedefault", "undirected");
+
+    const auto& nodes = *context.m_nodes;
+
+    for (std::uint32_t i = 0; i < nodes.size(); i++) {
+        xml.writeStartElement("node");
+        xml.writeAttribute("id", getNodeId(i));
+        auto name = nodes.name(i);
+
+        writeData(xml, "label", QString::fromUtf8(name.data(), static_cast<qsizetype>(name.size())));
+        writeData(xml, "x", QString::number(nodes.x(i)));
+        writeData(xml, "y", QString::number(nodes.y(i)));
+        xml.writeEndElement();
+    }
+
+    const auto& edgeTable = *context.m_edgeTable;
+    const auto& channels  = *context.m_channels;
+
+    for (std::size_t i = 0; i < edgeTable.size(); i++) {
+        auto channel = edgeTable.channel(i);
+
+        xml.writeStartElement("edge");
+        xml.writeAttribute("source", getNodeId(edgeTable.source(i)));
+        xml.writeAttribute("target", getNodeId(edgeTable.target(i)));
+
+        if (channel < channels.size()) {
+            writeData(xml, "capacity", QString::number(channels[channel].m_capacity));
+            writeData(xml, "price", QString::number(channels[channel].m_price));
+        }
+
+        xml.writeEndElement();
+    }
+
+    xml.writeEndElement(); // graph
+    xml.writeEndElement(); // graphml
+    xml.writeEndDocument();
+
+    return !xml.hasError() && file.commit();
+}
+
+bool TopologyWriter::saveGml(const ProjectContext& context, const std::string_view& filename) noexcept
+{
+    QSaveFile file(QString::fromUtf8(filename.data(), static_cast<qsizetype>(filename.size())));
+
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    bool isOk {true};
+    m_buffer.clear();
+    m_buffer.reserve(GML_BUFFER_SIZE);
+
+    auto flush = [this, &file, &isOk]() {
+        auto size = static_cast<qint64>(m_buffer.size());
+        isOk      = isOk && file.write(m_buffer.data(), size) == size;
+        m_buffer.clear();
+    };
+
+    auto put = [this](std::uint64_t value) {
+        char number[MAX_NUMBER_WIDTH];
+        auto result = std::to_chars(number, number + MAX_NUMBER_WIDTH, value);
+
+        m_buffer.append(number, result.ptr);
+    };
+
+    m_buffer.append("graph [\n  directed 0\n");
+
+    const auto& nodes = *context.m_nodes;
+
+    for (std::uint32_t i = 0; i < nodes.size(); i++) {
+        m_buffer.append("  node [\n    id ");
+        put(i);
+        m_buffer.append("\n    label \"");
+
+        // GML strings can't contain quotes
+        auto nameOffset = m_buffer.size();
+        m_buffer.append(nodes.name(i));
+        std::replace(m_buffer.begin() + static_cast<std::ptrdiff_t>(nameOffset), m_buffer.end(), '"', '\'');
+
+        m_buffer.append("\"\n    graphics [\n      x ");
+        put(nodes.x(i));
+        m_buffer.append("\n      y ");
+        put(nodes.y(i));
+        m_buffer.append("\n    ]\n  ]\n");
+
+        if (m_buffer.size() >= GML_BUFFER_SIZE)
+            flush();
+    }
+
+    const auto& edgeTable = *context.m_edgeTable;
+    const auto& channels  = *context.m_channels;
+
+    for (std::size_t i = 0; i < edgeTable.size(); i++) {
+        auto channel = edgeTable.channel(i);
+
+        m_buffer.append("  edge [\n    source ");
+        put(edgeTable.source(i));
+        m_buffer.append("\n    target ");
+        put(edgeTable.target(i));
+
+        if (channel < channels.size()) {
+            m_buffer.append("\n    capacity ");
+            put(channels[channel].m_capacity);
+            m_buffer.append("\n    price ");
+            put(channels[channel].m_price);
+        }
+
+        m_buffer.append("\n  ]\n");
+
+        if (m_buffer.size() >= GML_BUFFER_SIZE)
+            flush();
+    }
+
+    m_buffer.append("]\n");
+    flush();
+
+    return isOk && file.commit();
+}
+
+} // namespace netd
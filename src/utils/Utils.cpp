@@ -34,14 +34,20 @@ QString getItem(const QTableWidget *table, std::size_t row, std::size_t column)
     return item->text();
 }
 
-void printProjectContext(void) noexcept
+QString toQString(const std::string_view& str) noexcept
 {
-    const auto& context = ProjectContext::instance();
-    std::println("Node Count: {}\nNodes:", context.m_nodes.size());
+    return QString::fromUtf8(str.data(), static_cast<qsizetype>(str.size()));
+}
+
+void printProjectContext(const ProjectContext& context) noexcept
+{
+    std::println("Node Count: {}\nNodes:", context.m_nodes->size());
+
+    const auto& nodes = *context.m_nodes;
 
-    for (const auto& node : context.m_nodes) {
+    for (size_t i = 0; i < nodes.size(); i++) {
         std::println("node: | id: {}, name: {}, x: {}, y: {} |",
-            node.m_id, node.m_name, node.m_x, node.m_y
+            nodes.id(i), nodes.name(i), nodes.x(i), nodes.y(i)
         );
     }
 
@@ -55,23 +61,24 @@ void printProjectContext(void) noexcept
     std::putchar('\n');
 
     std::puts("\nEdge Table:");
-    for (size_t i = 0; i < context.m_edgeTable.size1(); i++) {
-        std::putchar('|');
-        for (size_t j = 0; j < 3; j++)
-            std::print(" {:>3}", context.m_edgeTable(i, j));
-        std::puts("   |");
+    const auto& edgeTable = *context.m_edgeTable;
+
+    for (size_t i = 0; i < edgeTable.size(); i++) {
+        std::println("| {:>3} {:>3} {:>3}   |",
+            edgeTable.source(i), edgeTable.target(i), edgeTable.channel(i)
+        );
     }
     std::putchar('\n');
 
     std::puts("\nRouter Table:");
-    for (const auto& router : context.m_routers) {
+    for (const auto& router : *context.m_routers) {
         std::println("router: | id: {}, model: {}, capacity: {}, price: {} |",
             router.m_id, router.m_model, router.m_capacity, router.m_price
         );
     }
 
     std::puts("\nChannel Table:");
-    for (const auto& channel : context.m_channels) {
+    for (const auto& channel : *context.m_channels) {
         std::println("channel: | id: {}, capacity: {}, price: {} |",
             channel.m_id, channel.m_capacity, channel.m_price
         );
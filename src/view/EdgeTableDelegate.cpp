@@ -0,0 +1,72 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/EdgeTableDelegate.hpp>
+#include <NetDesign/EdgeTableModel.hpp>
+#include <NetDesign/Utils.hpp>
+#include <QtWidgets/QCompleter>
+#include <QtWidgets/QComboBox>
+
+
+namespace netd {
+
+EdgeTableDelegate::EdgeTableDelegate(QAbstractItemModel *nodeNames, const ProjectContext& context, QObject *parent) noexcept
+    : QStyledItemDelegate(parent), m_nodeNames(nodeNames), m_context(&context)
+{
+}
+
+QWidget *EdgeTableDelegate::createEditor(QWidget *parent, const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    IGNORE_UNUSED(option);
+
+    auto editor = new QComboBox(parent);
+
+    if (index.column() == EDGE_CHANNEL_COLUMN) {
+        for (const auto& channel : *m_context->m_channels)
+            editor->addItem(QString::number(channel.m_capacity));
+
+        return editor;
+    }
+
+    // typed text selects node, names containing it are suggested
+    editor->setModel(m_nodeNames);
+    editor->setEditable(true);
+    editor->setInsertPolicy(QComboBox::NoInsert);
+    editor->completer()->setCompletionMode(QCompleter::PopupCompletion);
+    editor->completer()->setFilterMode(Qt::MatchContains);
+
+    return editor;
+}
+
+void EdgeTableDelegate::setEditorData(QWidget *editor, const QModelIndex& index) const
+{
+    auto comboBox = qobject_cast<QComboBox*>(editor);
+
+    if (comboBox)
+        comboBox->setCurrentIndex(index.data(Qt::EditRole).toInt());
+}
+
+void EdgeTableDelegate::setModelData(QWidget *editor, QAbstractItemModel *model, const QModelIndex& index) const
+{
+    auto comboBox = qobject_cast<QComboBox*>(editor);
+
+    if (comboBox && comboBox->currentIndex() >= 0)
+        model->setData(index, comboBox->currentIndex(), Qt::EditRole);
+}
+
+} // namespace netd
@@ -0,0 +1,201 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <QtWidgets/QStyleOptionGraphicsItem>
+#include <NetDesign/EdgeTileItem.hpp>
+#include <NetDesign/Utils.hpp>
+#include <QtGui/QPainter>
+#include <algorithm>
+#include <numeric>
+
+
+namespace netd {
+
+constexpr double EDGE_WIDTH          {3.0};
+constexpr double MAX_EDGE_WIDTH      {EDGE_WIDTH + static_cast<double>(HEAT_CLASS_COUNT - 2)};
+constexpr double MIN_EDGE_PIXELS     {3.0};  // shorter edges shade tile cell
+constexpr double PIXELS_PER_LINE     {16.0}; // limit of lines per tile area
+constexpr std::size_t MIN_TILE_LINES {16};
+constexpr std::size_t MIN_SHADE_ALPHA {32};
+constexpr std::size_t MAX_SHADE_ALPHA {160};
+
+EdgeTileItem::EdgeTileItem(const QRectF& cell) noexcept : m_cell(cell)
+{
+    setAcceptedMouseButtons(Qt::NoButton);
+}
+
+void EdgeTileItem::addEdge(const QLineF& line) noexcept
+{
+    m_edgeLines.push_back({static_cast<std::uint32_t>(m_lines.size())});
+    m_lines.push_back(line);
+}
+
+void EdgeTileItem::finish(void) noexcept
+{
+    QRectF bounds {m_cell};
+
+    for (const auto& line : m_lines)
+        bounds |= QRectF(line.p1(), line.p2()).normalized();
+
+    prepareGeometryChange();
+    m_bounds = bounds.adjusted(-MAX_EDGE_WIDTH, -MAX_EDGE_WIDTH, MAX_EDGE_WIDTH, MAX_EDGE_WIDTH);
+
+    sortLines();
+}
+
+void EdgeTileItem::sortLines(void) noexcept
+{
+    std::vector<std::uint32_t> order(m_lines.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    // longest edges of each heat first, so visible edges are prefix of heat range
+    std::ranges::stable_sort(order, [this](std::uint32_t a, std::uint32_t b) {
+        if (m_edgeLines[a].m_heat != m_edgeLines[b].m_heat)
+            return m_edgeLines[a].m_heat < m_edgeLines[b].m_heat;
+
+        return m_lines[a].length() > m_lines[b].length();
+    });
+
+    std::vector<QLineF> lines(m_lines.size());
+    std::vector<EdgeLine> edgeLines(m_edgeLines.size());
+    m_heatOffsets.fill(0);
+
+    for (std::size_t i = 0; i < order.size(); i++) {
+        lines[i]     = m_lines[order[i]];
+        edgeLines[i] = m_edgeLines[order[i]];
+        m_heatOffsets[edgeLines[i].m_heat]++;
+    }
+
+    // counts of heat classes to offsets of their ranges
+    std::exclusive_scan(m_heatOffsets.begin(), m_heatOffsets.end(), m_heatOffsets.begin(), std::size_t {0});
+
+    m_lines     = std::move(lines);
+    m_edgeLines = std::move(edgeLines);
+}
+
+void EdgeTileItem::setHeat(std::span<const float> utilizations, float threshold) noexcept
+{
+    for (auto& edgeLine : m_edgeLines) {
+        auto heat       = utilizations.empty() ? 0 : getHeat(utilizations[edgeLine.m_edge], threshold);
+        edgeLine.m_heat = static_cast<std::uint8_t>(heat);
+    }
+
+    // item is kept, only its line order & pens change
+    sortLines();
+    update();
+}
+
+std::size_t EdgeTileItem::getHeat(float utilization, float threshold) noexcept
+{
+    if (utilization < threshold)
+        return 0;
+
+    return 1 + static_cast<std::size_t>(std::ranges::upper_bound(HEAT_BOUNDS, utilization) - HEAT_BOUNDS.begin());
+}
+
+QColor EdgeTileItem::getHeatColor(std::size_t heat) noexcept
+{
+    // from idle green to overloaded red
+    static const std::array<QColor, HEAT_CLASS_COUNT> colors {
+        QColor(Qt::gray), QColor(0, 160, 0), QColor(150, 200, 0),
+        QColor(240, 200, 0), QColor(255, 120, 0), QColor(220, 0, 0),
+    };
+
+    return colors[std::min(heat, HEAT_CLASS_COUNT - 1)];
+}
+
+double EdgeTileItem::getHeatWidth(std::size_t heat) noexcept
+{
+    // busier edges are drawn thicker
+    return (heat == 0) ? EDGE_WIDTH : EDGE_WIDTH + static_cast<double>(heat - 1);
+}
+
+void EdgeTileItem::visibleCounts(double lod, HeatCounts& counts) const noexcept
+{
+    // lines that don't fit into tile on screen would only overdraw each other
+    auto tilePixels = m_cell.width() * m_cell.height() * lod * lod;
+    auto maxCount   = std::max(MIN_TILE_LINES, static_cast<std::size_t>(tilePixels / PIXELS_PER_LINE));
+    auto minLength  = MIN_EDGE_PIXELS / lod;
+
+    // the hottest edges are the last to be hidden
+    for (auto heat = HEAT_CLASS_COUNT; heat-- > 0;) {
+        auto begin = m_lines.begin() + static_cast<std::ptrdiff_t>(m_heatOffsets[heat]);
+        auto end   = (heat + 1 < HEAT_CLASS_COUNT) ? m_lines.begin() + static_cast<std::ptrdiff_t>(m_heatOffsets[heat + 1])
+                                                   : m_lines.end();
+
+        auto it = std::partition_point(begin, end, [minLength](const QLineF& line) {
+            return line.length() >= minLength;
+        });
+
+        counts[heat] = std::min(static_cast<std::size_t>(it - begin), maxCount);
+        maxCount    -= counts[heat];
+    }
+}
+
+QRectF EdgeTileItem::boundingRect(void) const
+{
+    return m_bounds;
+}
+
+void EdgeTileItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    IGNORE_UNUSED(widget);
+
+    auto lod = option->levelOfDetailFromTransform(painter->worldTransform());
+
+    if (lod <= 0.0 || m_lines.empty())
+        return;
+
+    HeatCounts counts;
+    visibleCounts(lod, counts);
+
+    auto count = std::accumulate(counts.begin(), counts.end(), std::size_t {0});
+    painter->save();
+
+    // edges too short to be seen are aggregated into cell shading
+    if (count < m_lines.size()) {
+        auto alpha = std::min(MAX_SHADE_ALPHA, MIN_SHADE_ALPHA + m_lines.size() - count);
+        painter->fillRect(m_cell, QColor(128, 128, 128, static_cast<std::int32_t>(alpha)));
+    }
+
+    auto isAntialiased = painter->testRenderHint(QPainter::Antialiasing);
+
+    // hotter edges are drawn on top, a single call per heat class
+    for (std::size_t heat = 0; heat < HEAT_CLASS_COUNT; heat++) {
+        if (counts[heat] == 0)
+            continue;
+
+        auto width = getHeatWidth(heat);
+
+        // thin edges are drawn by cosmetic pen without antialiasing
+        if (width * lod >= 1.0) {
+            painter->setPen(QPen(getHeatColor(heat), width));
+            painter->setRenderHint(QPainter::Antialiasing, isAntialiased);
+        }
+        else {
+            painter->setPen(QPen(getHeatColor(heat), 0));
+            painter->setRenderHint(QPainter::Antialiasing, false);
+        }
+
+        painter->drawLines(m_lines.data() + m_heatOffsets[heat], static_cast<std::int32_t>(counts[heat]));
+    }
+
+    painter->restore();
+}
+
+} // namespace netd
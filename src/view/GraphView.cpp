@@ -16,57 +16,106 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <QtWidgets/QGraphicsPixmapItem>
 #include <QtWidgets/QGraphicsView>
 #include <NetDesign/GraphView.hpp>
 #include <QtWidgets/QPushButton>
+#include <NetDesign/EdgeTileItem.hpp>
+#include <NetDesign/RouteItem.hpp>
+#include <NetDesign/NodeItem.hpp>
+#include <NetDesign/Utils.hpp>
+#include <QtWidgets/QToolTip>
 #include <filesystem>
+#include <algorithm>
+#include <limits>
+#include <cmath>
 
 
 namespace netd {
 
-constexpr auto NODE_RADIUS {16};
-
+constexpr std::uint32_t TILE_SIZE {256}; // scene units
+constexpr double SCENE_MARGIN     {128.0};  // scene units around nodes
+constexpr double ZOOM_STEP        {1.0015}; // scale per wheel angle unit
+constexpr double MIN_SCALE        {1e-4};
+constexpr double MAX_SCALE        {16.0};
+constexpr double PICK_PIXELS      {6.0};    // hit test distance on screen
+constexpr double SNAP_PIXELS      {24.0};   // click selects node within distance
+constexpr double NODE_PICK_RADIUS {32.0};   // scene units around node position
+constexpr double CLICK_PIXELS     {4.0};    // longer drag isn't click
+const QRectF DEFAULT_SCENE_RECT   {0, 0, 1024, 768};
 
 GraphView::GraphView(QWidget *parent) noexcept
 {
     m_mainLayout = new QHBoxLayout(parent);
     m_tab        = new QWidget(parent);
 
+    loadNodeIcon();
     setGraphLayout();
     setButtonLayout();
 
+    // set the tooltip style
+    m_tab->setStyleSheet(
+        "QToolTip {"
+        "color: black;"
+        "background-color: white;"
+        "border: 2px solid black;"
+        "padding: 5px;"
+        "}"
+    );
+
     m_tab->setLayout(m_mainLayout);
 }
 
+void GraphView::loadNodeIcon(void) noexcept
+{
+    auto currentPath    = std::filesystem::current_path();
+    auto routerIconPath = QString(currentPath.c_str()) + "/res/router64x64.png";
+
+    // rotate by 180 degrees, icon is shared by all node items
+    QTransform transform;
+    transform.rotate(180);
+    m_nodeIcon = QPixmap(routerIconPath).transformed(transform, Qt::SmoothTransformation);
+}
+
 void GraphView::setGraphLayout(void) noexcept
 {
     m_graphLayout = new QVBoxLayout();
 
-    // setup graphics scene
-    m_scene = new QGraphicsScene();
-    m_scene->setSceneRect(0, 0, 1024, 768);
+    // setup graphics scene, its rect follows nodes
+    m_scene = new QGraphicsScene(m_tab);
+    m_scene->setSceneRect(DEFAULT_SCENE_RECT);
 
-    auto view = new QGraphicsView(m_scene);
+    m_routeItem = new RouteItem();
+    m_scene->addItem(m_routeItem);
 
-    view->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    view->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    view->setRenderHint(QPainter::Antialiasing);
+    m_view = new QGraphicsView(m_scene);
+
+    m_view->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    m_view->setHorizontalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    m_view->setRenderHint(QPainter::Antialiasing);
+    m_view->setTransformationAnchor(QGraphicsView::AnchorUnderMouse);
+    m_view->setDragMode(QGraphicsView::ScrollHandDrag);
 
     // invert y-axis
     QTransform transform;
-    transform.translate(0, m_scene->sceneRect().height());
     transform.scale(1, -1);
-    view->setTransform(transform);
+    m_view->setTransform(transform);
+
+    // rubber band is kept in scene coordinates until mouse is released
+    connect(m_view, &QGraphicsView::rubberBandChanged, this, [this](QRect rect, QPointF from, QPointF to) {
+        if (!rect.isNull())
+            this->m_rubberBand = QRectF(from, to).normalized();
+    });
 
-    m_graphLayout->addWidget(view);
+    m_view->viewport()->installEventFilter(this);
+
+    m_graphLayout->addWidget(m_view);
     m_mainLayout->addLayout(m_graphLayout);
 }
 
 void GraphView::setEdgeTable(void) noexcept
 {
-    m_edgeTable = new QTableWidget(0, 3, m_tab);
-    m_edgeTable->setHorizontalHeaderLabels({"Source Node", "Destination Node", "Channel"});
+    // headers are provided by edge table model
+    m_edgeTable = new QTableView(m_tab);
     m_edgeTable->setMaximumWidth(315);
 
     m_loadTable = new QTableWidget(0, 2, m_tab);
@@ -97,7 +146,14 @@ void GraphView::setButtonLayout(void) noexcept
     m_buttonLayout->setAlignment(Qt::AlignTop);
 
     m_findRouteButton = new QPushButton("Find Route");
+    m_cancelButton    = new QPushButton("Cancel");
+    m_progressBar     = new QProgressBar();
     m_updateButton    = new QPushButton("Update");
+    m_fitButton       = new QPushButton("Fit View");
+    m_layoutButton    = new QPushButton("Auto Layout");
+
+    m_progressBar->setRange(0, 100);
+    setAnalysisRunning(false);
 
     // connect nodes
     setEdgeTable();
@@ -106,7 +162,13 @@ void GraphView::setButtonLayout(void) noexcept
     m_submitButton = new QPushButton("Submit");
 
     m_buttonLayout->addWidget(m_findRouteButton);
+    m_buttonLayout->addWidget(m_cancelButton);
+    m_buttonLayout->addWidget(m_progressBar);
     m_buttonLayout->addWidget(m_updateButton);
+    m_buttonLayout->addWidget(m_fitButton);
+    m_buttonLayout->addWidget(m_layoutButton);
+
+    setHeatmapLayout();
     m_buttonLayout->addWidget(m_edgeTable);
     m_buttonLayout->addWidget(m_loadTable);
     m_buttonLayout->addWidget(m_addButton);
@@ -115,57 +177,487 @@ void GraphView::setButtonLayout(void) noexcept
     m_mainLayout->addLayout(m_buttonLayout);
 }
 
-void GraphView::drawNode(const Node& node) noexcept
+void GraphView::setHeatmapLayout(void) noexcept
 {
-    auto currentPath    = std::filesystem::current_path();
-    auto routerIconPath = QString(currentPath.c_str()) + "/res/router64x64.png";
+    m_heatmapCheckBox  = new QCheckBox("Utilization Heatmap");
+    m_thresholdSpinBox = new QSpinBox();
+    m_legendLabel      = new QLabel();
+
+    m_thresholdSpinBox->setRange(0, 100);
+    m_thresholdSpinBox->setSingleStep(5);
+    m_thresholdSpinBox->setPrefix("Threshold: ");
+    m_thresholdSpinBox->setSuffix("%");
+
+    // legend of heat classes, edges below threshold are gray
+    QString legend;
+    auto lower = 0.0f;
+
+    for (std::size_t heat = 1; heat < HEAT_CLASS_COUNT; heat++) {
+        auto color = EdgeTileItem::getHeatColor(heat).name();
+
+        if (heat - 1 < HEAT_BOUNDS.size()) {
+            auto upper = HEAT_BOUNDS[heat - 1];
+            legend += QString("<font color=\"%1\">&#9632;</font> %2-%3%<br>").arg(color)
+                .arg(static_cast<std::int32_t>(lower * 100)).arg(static_cast<std::int32_t>(upper * 100));
+            lower = upper;
+        }
+        else
+            legend += QString("<font color=\"%1\">&#9632;</font> overloaded").arg(color);
+    }
+
+    m_legendLabel->setText(legend);
+
+    m_buttonLayout->addWidget(m_heatmapCheckBox);
+    m_buttonLayout->addWidget(m_thresholdSpinBox);
+    m_buttonLayout->addWidget(m_legendLabel);
+}
 
-    // loade the image
-    QPixmap pixmap(routerIconPath);
+void GraphView::updateGraph(const ProjectContext& context) noexcept
+{
+    bool isNodesSame = m_nodes.isSame(context.m_nodes);
+    bool isEdgesSame = isNodesSame && m_edges.isSame(context.m_edgeTable) && m_channels.isSame(context.m_channels);
 
-    // rotate by 180 degrees
-    QTransform transform;
-    transform.rotate(180);
-    auto rotatedPixmap = pixmap.transformed(transform, Qt::SmoothTransformation);
+    // previous snapshot is kept until nodes are compared
+    auto oldNodes = m_nodes;
 
-    auto rotatedPixmapItem = new QGraphicsPixmapItem(rotatedPixmap);
-    rotatedPixmapItem->setPos(node.m_x - (NODE_RADIUS), node.m_y - (NODE_RADIUS));
+    m_nodes    = context.m_nodes;
+    m_edges    = context.m_edgeTable;
+    m_channels = context.m_channels;
 
-    // set the tooltip for the pixmap item
-    auto tip = QString("Node ID: %1\nName: %2\nPosition: (%3, %4)")
-        .arg(node.m_id).arg(QString::fromStdString(node.m_name)).arg(node.m_x).arg(node.m_y);
-    rotatedPixmapItem->setToolTip(tip);
+    if (!isNodesSame)
+        updateNodes(*oldNodes);
 
-    // set the tooltip style
-    m_tab->setStyleSheet(
-        "QToolTip {"
-        "color: black;"
-        "background-color: white;"
-        "border: 2px solid black;"
-        "padding: 5px;"
-        "}"
-    );
+    if (!isEdgesSame) {
+        updateEdges();
+
+        // index is packed from scratch, it is cheaper than scene update
+        m_index.set(*m_nodes, *m_edges);
+        updateSceneRect();
+        updateRoutes();
+    }
+
+    // view is fitted once it has size
+    if (!m_isFitted && !m_index.empty() && m_view->isVisible())
+        fitView();
+}
 
-    m_scene->addItem(rotatedPixmapItem);
+void GraphView::updateNodes(const NodeTable& oldNodes) noexcept
+{
+    const auto& nodes = *m_nodes;
+    auto count = static_cast<std::uint32_t>(std::min(nodes.size(), m_nodeItems.size()));
+
+    for (std::uint32_t i = 0; i < count; i++) {
+        bool isMoved   = nodes.x(i) != oldNodes.x(i) || nodes.y(i) != oldNodes.y(i);
+        bool isRenamed = nodes.id(i) != oldNodes.id(i) || nodes.name(i) != oldNodes.name(i);
+
+        if (isMoved || isRenamed)
+            m_nodeItems[i]->refresh();
+    }
+
+    // item is removed from scene when deleted
+    for (std::size_t i = count; i < m_nodeItems.size(); i++)
+        delete m_nodeItems[i];
+
+    m_nodeItems.resize(count);
+
+    std::erase_if(m_selectedNodes, [count](std::uint32_t node) {
+        return node >= count;
+    });
+
+    for (auto i = count; i < nodes.size(); i++) {
+        auto item = new NodeItem(m_nodes, m_nodeIcon, i);
+
+        m_scene->addItem(item);
+        m_nodeItems.push_back(item);
+    }
+}
+
+std::vector<EdgeRecord> GraphView::getEdgeRecords(void) const noexcept
+{
+    const auto& nodes     = *m_nodes;
+    const auto& edgeTable = *m_edges;
+    const auto& channels  = *m_channels;
+
+    std::vector<EdgeRecord> records;
+    records.reserve(edgeTable.size());
+
+    for (std::size_t i = 0; i < edgeTable.size(); i++) {
+        auto src     = edgeTable.source(i);
+        auto dest    = edgeTable.target(i);
+        auto channel = edgeTable.channel(i);
+
+        if (src >= nodes.size() || dest >= nodes.size() || channel >= channels.size())
+            continue;
+
+        // edge belongs to tile of its midpoint
+        auto x = (static_cast<std::uint64_t>(nodes.x(src)) + nodes.x(dest)) / 2 / TILE_SIZE;
+        auto y = (static_cast<std::uint64_t>(nodes.y(src)) + nodes.y(dest)) / 2 / TILE_SIZE;
+
+        records.push_back({(x << 32) | y, nodes.x(src), nodes.y(src), nodes.x(dest), nodes.y(dest),
+                           static_cast<std::uint32_t>(i)});
+    }
+
+    std::ranges::sort(records);
+    return records;
+}
+
+void GraphView::updateEdges(void) noexcept
+{
+    auto records = getEdgeRecords();
+    const auto& oldRecords = m_edgeRecords;
+
+    // both arrays are sorted by tile, so tiles are compared in one pass
+    for (std::size_t i = 0, j = 0; i < oldRecords.size() || j < records.size();) {
+        auto tile = std::numeric_limits<std::uint64_t>::max();
+
+        if (i < oldRecords.size())
+            tile = oldRecords[i].m_tile;
+
+        if (j < records.size())
+            tile = std::min(tile, records[j].m_tile);
+
+        auto oldBegin = i, begin = j;
+
+        while (i < oldRecords.size() && oldRecords[i].m_tile == tile)
+            i++;
+
+        while (j < records.size() && records[j].m_tile == tile)
+            j++;
+
+        std::span<const EdgeRecord> oldTile(oldRecords.data() + oldBegin, i - oldBegin);
+        std::span<const EdgeRecord> newTile(records.data() + begin, j - begin);
+
+        if (!std::ranges::equal(oldTile, newTile))
+            updateTile(tile, newTile);
+    }
+
+    m_edgeRecords = std::move(records);
+
+    // rebuilt tiles have no heat, edited edge table invalidates usage
+    if (m_isHeatShown)
+        updateHeatmap();
 }
 
-void GraphView::drawEdge(const Node& src, const Node& dest, const Channel& channel) noexcept
+void GraphView::updateTile(std::uint64_t tile, std::span<const EdgeRecord> records) noexcept
 {
-    QLineF line(src.m_x, src.m_y, dest.m_x, dest.m_y);
+    auto it = m_tileItems.find(tile);
+
+    // tile is small, so it is rebuilt rather than edited
+    if (it != m_tileItems.end()) {
+        delete it->second;
+        m_tileItems.erase(it);
+    }
+
+    if (records.empty())
+        return;
 
-    auto lineItem = new QGraphicsLineItem(line);
-    lineItem->setPen(QPen(Qt::gray, 3));
+    QRectF cell(static_cast<double>((tile >> 32) * TILE_SIZE), static_cast<double>((tile & 0xFFFFFFFF) * TILE_SIZE),
+                TILE_SIZE, TILE_SIZE);
 
-    auto tip = QString("Channel ID: %1\nCapacity: %2\nPrice: %3")
-        .arg(channel.m_id).arg(channel.m_capacity).arg(channel.m_price);
+    auto item = new EdgeTileItem(cell);
 
-    lineItem->setToolTip(tip);
-    m_scene->addItem(lineItem);
+    for (const auto& record : records)
+        item->addEdge(QLineF(record.m_srcX, record.m_srcY, record.m_destX, record.m_destY));
+
+    item->finish();
+    m_scene->addItem(item);
+    m_tileItems.emplace(tile, item);
+}
+
+void GraphView::updateSceneRect(void) noexcept
+{
+    if (m_index.empty()) {
+        m_scene->setSceneRect(DEFAULT_SCENE_RECT);
+        return;
+    }
+
+    auto bounds = m_index.bounds();
+    QRectF rect(QPointF(bounds.m_minX, bounds.m_minY), QPointF(bounds.m_maxX, bounds.m_maxY));
+
+    m_scene->setSceneRect(rect.adjusted(-SCENE_MARGIN, -SCENE_MARGIN, SCENE_MARGIN, SCENE_MARGIN));
 }
 
-void GraphView::clearGraph(void) noexcept
+void GraphView::fitView(void) noexcept
 {
-    m_scene->clear();
+    m_view->fitInView(m_scene->sceneRect(), Qt::KeepAspectRatio);
+    m_isFitted = true;
+}
+
+double GraphView::getScale(void) const noexcept
+{
+    // y-axis is inverted, so only magnitude of scale matters
+    return std::abs(m_view->transform().m11());
+}
+
+bool GraphView::eventFilter(QObject *object, QEvent *event)
+{
+    if (object != m_view->viewport())
+        return QObject::eventFilter(object, event);
+
+    switch (event->type()) {
+        case QEvent::Wheel:
+            zoom(static_cast<QWheelEvent*>(event));
+            return true;
+
+        case QEvent::ToolTip:
+            showToolTip(static_cast<QHelpEvent*>(event));
+            return true;
+
+        case QEvent::MouseButtonPress: {
+            auto mouseEvent = static_cast<QMouseEvent*>(event);
+            bool isSelecting = mouseEvent->modifiers().testFlag(Qt::ShiftModifier);
+
+            // drag mode is chosen before view handles press
+            m_view->setDragMode(isSelecting ? QGraphicsView::RubberBandDrag : QGraphicsView::ScrollHandDrag);
+            m_pressPosition = mouseEvent->position();
+            m_rubberBand    = {};
+            break;
+        }
+
+        case QEvent::MouseButtonRelease:
+            finishSelection(static_cast<QMouseEvent*>(event));
+            break;
+
+        case QEvent::Resize:
+            if (!m_isFitted && !m_index.empty())
+                fitView();
+            break;
+
+        default:
+            break;
+    }
+
+    return QObject::eventFilter(object, event);
+}
+
+void GraphView::zoom(const QWheelEvent *event) noexcept
+{
+    // scale changes with wheel angle, so touchpads zoom smoothly
+    auto scale  = getScale();
+    auto factor = std::pow(ZOOM_STEP, event->angleDelta().y());
+    factor      = std::clamp(scale * factor, MIN_SCALE, MAX_SCALE) / scale;
+
+    m_view->scale(factor, factor);
+}
+
+void GraphView::showToolTip(const QHelpEvent *event) noexcept
+{
+    auto point    = m_view->mapToScene(event->pos());
+    auto distance = PICK_PIXELS / getScale();
+    QString toolTip;
+
+    // nodes are drawn over edges, so they are hit first
+    if (auto node = m_index.findNode(point.x(), point.y(), std::max(NODE_PICK_RADIUS, distance)))
+        toolTip = getNodeToolTip(*node);
+    else if (auto edge = m_index.findEdge(point.x(), point.y(), distance))
+        toolTip = getEdgeToolTip(*edge);
+
+    if (toolTip.isEmpty())
+        QToolTip::hideText();
+    else
+        QToolTip::showText(event->globalPos(), toolTip, m_view->viewport());
+}
+
+QString GraphView::getNodeToolTip(std::uint32_t node) const noexcept
+{
+    const auto& nodes = *m_nodes;
+
+    return QString("Node ID: %1\nName: %2\nPosition: (%3, %4)")
+        .arg(nodes.id(node)).arg(toQString(nodes.name(node)))
+        .arg(nodes.x(node)).arg(nodes.y(node));
+}
+
+QString GraphView::getEdgeToolTip(std::uint32_t edge) const noexcept
+{
+    const auto& channels = *m_channels;
+    auto channel = m_edges->channel(edge);
+
+    if (channel >= channels.size())
+        return {};
+
+    const auto& value = channels[channel];
+
+    auto toolTip = QString("Channel ID: %1\nCapacity: %2\nPrice: %3")
+        .arg(value.m_id).arg(value.m_capacity).arg(value.m_price);
+
+    // usage rows match drawn edge table while heat is shown
+    if (m_isHeatShown) {
+        auto utilization = static_cast<double>(m_linkUsage.m_utilizations[edge]);
+        auto delay       = m_linkUsage.m_delays[edge];
+
+        toolTip += QString("\nUtilization: %1%").arg(utilization * 100.0, 0, 'f', 1);
+
+        if (delay == std::numeric_limits<std::uint32_t>::max())
+            toolTip += "\nDelay: overloaded";
+        else
+            toolTip += QString("\nDelay: %1 ms").arg(delay);
+    }
+
+    return toolTip;
+}
+
+void GraphView::finishSelection(const QMouseEvent *event) noexcept
+{
+    bool isAdded = event->modifiers().testFlag(Qt::ControlModifier);
+
+    if (m_view->dragMode() == QGraphicsView::RubberBandDrag) {
+        std::vector<std::uint32_t> nodes;
+        SpatialBounds bounds {m_rubberBand.left(), m_rubberBand.top(), m_rubberBand.right(), m_rubberBand.bottom()};
+
+        if (!m_rubberBand.isEmpty())
+            m_index.findNodes(bounds, nodes);
+
+        selectNodes(nodes, isAdded);
+        return;
+    }
+
+    // drag pans view, click snaps to the nearest node
+    auto delta = event->position() - m_pressPosition;
+
+    if (std::abs(delta.x()) + std::abs(delta.y()) >= CLICK_PIXELS)
+        return;
+
+    auto point = m_view->mapToScene(event->position().toPoint());
+    auto node  = m_index.findNode(point.x(), point.y(), SNAP_PIXELS / getScale());
+
+    if (node)
+        selectNodes(std::span(&*node, 1), isAdded);
+    else
+        selectNodes({}, isAdded);
+}
+
+void GraphView::selectNodes(std::span<const std::uint32_t> nodes, bool isAdded) noexcept
+{
+    if (!isAdded) {
+        for (auto node : m_selectedNodes)
+            m_nodeItems[node]->setHighlighted(false);
+
+        m_selectedNodes.clear();
+    }
+
+    for (auto node : nodes) {
+        if (isAdded && std::ranges::find(m_selectedNodes, node) != m_selectedNodes.end())
+            continue;
+
+        m_nodeItems[node]->setHighlighted(true);
+        m_selectedNodes.push_back(node);
+    }
+
+    // route endpoints follow selection
+    if (m_selectedNodes.size() >= 1)
+        m_srcNodeComboBox->setCurrentIndex(static_cast<std::int32_t>(m_selectedNodes[0]));
+
+    if (m_selectedNodes.size() >= 2)
+        m_destNodeComboBox->setCurrentIndex(static_cast<std::int32_t>(m_selectedNodes[1]));
+}
+
+void GraphView::setAnalysisRunning(bool isRunning) noexcept
+{
+    m_findRouteButton->setEnabled(!isRunning);
+    m_cancelButton->setEnabled(isRunning);
+    m_progressBar->setValue(0);
+}
+
+void GraphView::setLayoutRunning(bool isRunning) noexcept
+{
+    m_layoutButton->setText(isRunning ? "Stop Layout" : "Auto Layout");
+}
+
+void GraphView::showLayout(std::span<const std::uint32_t> xs, std::span<const std::uint32_t> ys) noexcept
+{
+    auto oldNodes = m_nodes;
+    auto& nodes   = m_nodes.edit();
+    auto count    = std::min({nodes.size(), xs.size(), ys.size()});
+
+    for (std::size_t i = 0; i < count; i++)
+        nodes.setPosition(i, xs[i], ys[i]);
+
+    // all edges usually move, so every tile is rebuilt
+    updateNodes(*oldNodes);
+    updateEdges();
+
+    m_index.set(*m_nodes, *m_edges);
+    updateSceneRect();
+    updateRoutes();
+}
+
+void GraphView::setRoutes(std::vector<Route> routes, std::uint64_t edgeVersion) noexcept
+{
+    m_routes       = std::move(routes);
+    m_routeVersion = edgeVersion;
+
+    updateRoutes();
+}
+
+void GraphView::updateRoutes(void) noexcept
+{
+    const auto& nodes = *m_nodes;
+    const auto& edges = *m_edges;
+
+    std::vector<QLineF> lines;
+    std::vector<std::size_t> offsets {0};
+
+    // rows of other edge table version may refer to other edges
+    bool isShown = m_routeVersion == m_edges.version();
+
+    // edge row indexes edge table columns, so each edge is found in O(1)
+    for (std::size_t i = 0; isShown && i < m_routes.size(); i++) {
+        const auto& route = m_routes[i];
+
+        for (auto edge : route.m_edges) {
+            if (edge >= edges.size())
+                continue;
+
+            auto src  = edges.source(edge);
+            auto dest = edges.target(edge);
+
+            if (src < nodes.size() && dest < nodes.size())
+                lines.emplace_back(nodes.x(src), nodes.y(src), nodes.x(dest), nodes.y(dest));
+        }
+
+        offsets.push_back(lines.size());
+    }
+
+    m_routeItem->setRoutes(std::move(lines), std::move(offsets));
+}
+
+void GraphView::setLinkUsage(LinkUsage usage, std::uint64_t edgeVersion) noexcept
+{
+    m_linkUsage    = std::move(usage);
+    m_usageVersion = edgeVersion;
+
+    updateHeatmap();
+}
+
+void GraphView::updateHeatmap(void) noexcept
+{
+    bool isShown = m_heatmapCheckBox->isChecked() && m_usageVersion == m_edges.version();
+
+    // tiles without heat don't need recoloring
+    if (!isShown && !m_isHeatShown)
+        return;
+
+    m_isHeatShown  = isShown;
+    auto threshold = static_cast<float>(m_thresholdSpinBox->value()) / 100.0f;
+
+    std::vector<float> utilizations;
+
+    // records are sorted by tile, in order edges were added to tiles
+    for (std::size_t i = 0; i < m_edgeRecords.size();) {
+        auto tile = m_edgeRecords[i].m_tile;
+
+        utilizations.clear();
+
+        for (; i < m_edgeRecords.size() && m_edgeRecords[i].m_tile == tile; i++) {
+            if (isShown)
+                utilizations.push_back(m_linkUsage.m_utilizations[m_edgeRecords[i].m_edge]);
+        }
+
+        auto it = m_tileItems.find(tile);
+
+        if (it != m_tileItems.end())
+            it->second->setHeat(utilizations, threshold);
+    }
 }
 
 } // namespace netd
\ No newline at end of file
@@ -17,11 +17,13 @@
  */
 
 #include <NetDesign/MainWindow.hpp>
+#include <QtCore/QFileInfo>
 
 
 namespace netd {
 
 constexpr auto WINDOW_TITLE         {"NetDesign"};
+constexpr auto UNTITLED_PROJECT     {"Untitled"};
 constexpr auto WINDOW_MIN_WIDTH     {1024};
 constexpr auto WINDOW_MIN_HEIGHT    {768};
 constexpr auto WINDOW_MAX_WIDTH     {1920};
@@ -39,16 +41,86 @@ MainWindow::MainWindow(void) noexcept
     m_menuController = new MenuController(m_menuView, this);
     setMenuBar(m_menuView->getMenuBar());
 
-    // set tabs
-    m_tabView       = new TabView(this);
-    m_tabController = new TabController(m_tabView, this);
+    // set project tabs, each opened project has its own settings & graph tabs
+    m_projectTabs = new QTabWidget(this);
+    m_projectTabs->setTabsClosable(true);
+    m_projectTabs->setDocumentMode(true);
 
-    setCentralWidget(m_tabView->getTabWidget());
+    connect(m_projectTabs, &QTabWidget::tabCloseRequested, this, [this](std::int32_t index) {
+        this->closeProject(index);
+    });
+
+    setCentralWidget(m_projectTabs);
+    addProject();
+}
+
+Project& MainWindow::addProject(void) noexcept
+{
+    ProjectTab tab;
+    tab.m_project       = std::make_unique<Project>();
+    tab.m_tabView       = new TabView(m_projectTabs);
+    tab.m_tabController = new TabController(*tab.m_project, tab.m_tabView, this);
+
+    auto& project = *tab.m_project;
+    m_projects.push_back(std::move(tab));
+
+    auto index = m_projectTabs->addTab(m_projects.back().m_tabView->getTabWidget(), UNTITLED_PROJECT);
+    m_projectTabs->setCurrentIndex(index);
+
+    return project;
+}
+
+Project& MainWindow::currentProject(void) noexcept
+{
+    auto index = static_cast<std::size_t>(m_projectTabs->currentIndex());
+    return *m_projects.at(index).m_project;
+}
+
+bool MainWindow::selectProject(const std::string_view& filename) noexcept
+{
+    for (std::size_t i = 0; i < m_projects.size(); i++) {
+        if (m_projects[i].m_project->m_context.m_filename == filename) {
+            m_projectTabs->setCurrentIndex(static_cast<std::int32_t>(i));
+            return true;
+        }
+    }
+
+    return false;
 }
 
 void MainWindow::updateContent(void) noexcept
 {
-    m_tabController->updateContent();
+    auto index = m_projectTabs->currentIndex();
+
+    updateTitle(index);
+    m_projects.at(static_cast<std::size_t>(index)).m_tabController->updateContent();
+}
+
+void MainWindow::updateTitle(std::int32_t index) noexcept
+{
+    const auto& filename = m_projects.at(static_cast<std::size_t>(index)).m_project->m_context.m_filename;
+    auto title           = QFileInfo(QString::fromStdString(filename)).fileName();
+
+    m_projectTabs->setTabText(index, title.isEmpty() ? UNTITLED_PROJECT : title);
+    m_projectTabs->setTabToolTip(index, QString::fromStdString(filename));
+}
+
+void MainWindow::closeProject(std::int32_t index) noexcept
+{
+    auto it   = m_projects.begin() + index;
+    auto tabs = it->m_tabView->getTabWidget();
+
+    // widgets go first, so that no signal reaches deleted controllers
+    m_projectTabs->removeTab(index);
+    delete tabs;
+    delete it->m_tabController;
+    delete it->m_tabView;
+
+    // project journal is closed together with project
+    m_projects.erase(it);
+
+    if (m_projects.empty())
+        addProject();
 }
 
 MainWindow *mainWindow {nullptr};
@@ -33,10 +33,23 @@ void MenuView::createMenus(void) noexcept
     auto projectMenu = m_menu->addMenu("Project");
     auto newAction   = projectMenu->addAction("New");
     auto openAction  = projectMenu->addAction("Open");
-    auto saveAction  = projectMenu->addAction("Save");
-    auto exitAction  = projectMenu->addAction("Exit");
+    auto saveAction   = projectMenu->addAction("Save");
+    auto importAction = projectMenu->addAction("Import Topology");
+    auto exportAction = projectMenu->addAction("Export Topology");
+    auto exitAction   = projectMenu->addAction("Exit");
 
-    m_actions = {newAction, openAction, saveAction, exitAction};
+    // "Edit" menu
+    auto editMenu   = m_menu->addMenu("Edit");
+    auto undoAction = editMenu->addAction("Undo");
+    auto redoAction = editMenu->addAction("Redo");
+
+    undoAction->setShortcut(QKeySequence::Undo);
+    redoAction->setShortcut(QKeySequence::Redo);
+
+    m_actions = {
+        newAction, openAction, saveAction, importAction, exportAction, exitAction,
+        undoAction, redoAction
+    };
 }
 
 QList<QAction*>& MenuView::getActions(void) noexcept
@@ -0,0 +1,69 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <NetDesign/NodeItem.hpp>
+#include <NetDesign/Utils.hpp>
+#include <QtGui/QPainter>
+
+
+namespace netd {
+
+constexpr auto NODE_RADIUS {16};
+
+NodeItem::NodeItem(const Shared<NodeTable>& nodes, const QPixmap& icon, std::uint32_t position) noexcept
+    : m_nodes(&nodes), m_icon(&icon), m_position(position)
+{
+    setAcceptedMouseButtons(Qt::NoButton);
+
+    // nodes are drawn over edges
+    setZValue(1);
+    refresh();
+}
+
+void NodeItem::refresh(void) noexcept
+{
+    const auto& nodes = **m_nodes;
+    setPos(nodes.x(m_position), nodes.y(m_position));
+}
+
+void NodeItem::setHighlighted(bool isHighlighted) noexcept
+{
+    if (m_isHighlighted == isHighlighted)
+        return;
+
+    m_isHighlighted = isHighlighted;
+    update();
+}
+
+QRectF NodeItem::boundingRect(void) const
+{
+    return QRectF(QPointF(-NODE_RADIUS, -NODE_RADIUS), QSizeF(m_icon->size()));
+}
+
+void NodeItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    IGNORE_UNUSED(option, widget);
+    painter->drawPixmap(QPointF(-NODE_RADIUS, -NODE_RADIUS), *m_icon);
+
+    if (m_isHighlighted) {
+        painter->setPen(QPen(Qt::red, 0));
+        painter->drawRect(boundingRect());
+    }
+}
+
+} // namespace netd
@@ -39,7 +39,7 @@ NodeView::NodeView(QWidget *parent) noexcept
 void NodeView::setTablesLayout(void) noexcept
 {
     m_nodeTable       = new QTableWidget(0, 4, m_mainWidget);
-    m_matrixTable     = new QTableWidget(0, 0, m_mainWidget);
+    m_matrixTable     = new QTableView(m_mainWidget);
     auto tablesLayout = new QHBoxLayout();
 
     m_nodeTable->setHorizontalHeaderLabels({"ID", "Name", "X", "Y"});
@@ -0,0 +1,107 @@
+/**
+ * NetDesign - simple network design tool.
+ * Copyright (C) 2025 Alexander (@alkuzin)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <QtWidgets/QStyleOptionGraphicsItem>
+#include <NetDesign/RouteItem.hpp>
+#include <NetDesign/Utils.hpp>
+#include <QtGui/QPainter>
+#include <array>
+
+
+namespace netd {
+
+constexpr double ROUTE_WIDTH       {9.0}; // scene units, wider than hottest edge
+constexpr double ALTERNATIVE_WIDTH {6.0};
+constexpr double MIN_ROUTE_PIXELS  {3.0};
+
+RouteItem::RouteItem(void) noexcept
+{
+    setAcceptedMouseButtons(Qt::NoButton);
+
+    // routes are drawn over edges & under nodes
+    setZValue(0.5);
+}
+
+void RouteItem::setRoutes(std::vector<QLineF> lines, std::vector<std::size_t> offsets) noexcept
+{
+    QRectF bounds;
+
+    for (const auto& line : lines)
+        bounds |= QRectF(line.p1(), line.p2()).normalized();
+
+    prepareGeometryChange();
+    m_lines   = std::move(lines);
+    m_offsets = std::move(offsets);
+    m_bounds  = bounds.adjusted(-ROUTE_WIDTH, -ROUTE_WIDTH, ROUTE_WIDTH, ROUTE_WIDTH);
+
+    update();
+}
+
+QColor RouteItem::getRouteColor(std::size_t route) noexcept
+{
+    static const std::array<QColor, 4> colors {
+        QColor(0, 120, 255),
+        QColor(170, 0, 255),
+        QColor(0, 170, 170),
+        QColor(255, 0, 170),
+    };
+
+    return colors[route % colors.size()];
+}
+
+QRectF RouteItem::boundingRect(void) const
+{
+    return m_bounds;
+}
+
+void RouteItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    IGNORE_UNUSED(widget);
+
+    auto lod = option->levelOfDetailFromTransform(painter->worldTransform());
+
+    if (lod <= 0.0 || m_lines.empty())
+        return;
+
+    painter->save();
+
+    // the chosen route is drawn last, on top of alternatives
+    for (auto route = m_offsets.size() - 1; route-- > 0;) {
+        auto count = m_offsets[route + 1] - m_offsets[route];
+
+        if (count == 0)
+            continue;
+
+        QPen pen(getRouteColor(route), (route == 0) ? ROUTE_WIDTH : ALTERNATIVE_WIDTH);
+
+        if (pen.widthF() * lod < MIN_ROUTE_PIXELS) {
+            pen.setWidthF(MIN_ROUTE_PIXELS);
+            pen.setCosmetic(true);
+        }
+
+        if (route > 0)
+            pen.setStyle(Qt::DashLine);
+
+        painter->setPen(pen);
+        painter->drawLines(m_lines.data() + m_offsets[route], static_cast<std::int32_t>(count));
+    }
+
+    painter->restore();
+}
+
+} // namespace netd
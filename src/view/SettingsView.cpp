@@ -21,7 +21,10 @@
 
 namespace netd {
 
-SettingsView::SettingsView(QWidget *parent) noexcept
+constexpr std::int32_t NODE_PAGE   {0};
+constexpr std::int32_t ROUTER_PAGE {1};
+
+SettingsView::SettingsView(Project& project, QWidget *parent) noexcept
 {
     m_content    = new QStackedWidget(parent);
     m_mainLayout = new QHBoxLayout();
@@ -30,14 +33,14 @@ SettingsView::SettingsView(QWidget *parent) noexcept
 
     // add node tab
     m_nodeView         = new NodeView(parent);
-    m_nodeController   = new NodeController(m_nodeView);
+    m_nodeController   = new NodeController(project, m_nodeView);
 
     m_list->addItem("Node & Load Matrix");
     m_content->addWidget(m_nodeView->m_mainWidget);
 
     // add router tab
     m_routerView       = new RouterView(parent);
-    m_routerController = new RouterController(m_routerView);
+    m_routerController = new RouterController(project, m_routerView);
 
     m_list->addItem("Routers & Channels");
     m_content->addWidget(m_routerView->m_mainWidget);
@@ -45,6 +48,11 @@ SettingsView::SettingsView(QWidget *parent) noexcept
     // connect the list widget selection to change the stacked widget
     connect(m_list, &QListWidget::currentRowChanged, m_content, &QStackedWidget::setCurrentIndex);
 
+    // update page only when it is shown, so project sections are loaded on demand
+    connect(m_content, &QStackedWidget::currentChanged, [this](std::int32_t index) {
+        this->updatePage(index);
+    });
+
     // change font size of list widget entries
     QFont font = m_list->font();
     font.setPointSize(18);
@@ -56,10 +64,37 @@ SettingsView::SettingsView(QWidget *parent) noexcept
     m_tab->setLayout(m_mainLayout);
 }
 
+SettingsView::~SettingsView(void) noexcept
+{
+    // widgets are owned by tab, only controllers & views are deleted here
+    delete m_routerController;
+    delete m_nodeController;
+    delete m_routerView;
+    delete m_nodeView;
+}
+
 void SettingsView::updateContent(void) noexcept
 {
-    m_nodeController->updateContent();
-    m_routerController->updateContent();
+    m_isOutdated.fill(true);
+    updatePage(m_content->currentIndex());
+}
+
+void SettingsView::updatePage(std::int32_t index) noexcept
+{
+    if (index != NODE_PAGE && index != ROUTER_PAGE)
+        return;
+
+    auto& isOutdated = m_isOutdated[static_cast<std::size_t>(index)];
+
+    if (!isOutdated)
+        return;
+
+    isOutdated = false;
+
+    if (index == NODE_PAGE)
+        m_nodeController->updateContent();
+    else
+        m_routerController->updateContent();
 }
 
 } // namespace netd
\ No newline at end of file